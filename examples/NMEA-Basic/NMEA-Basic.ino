@@ -63,6 +63,7 @@ void onRmcUpdate(nmea::RmcData const rmc)
   else if (rmc.source == nmea::RmcSource::Galileo) Serial.print("Galileo");
   else if (rmc.source == nmea::RmcSource::GNSS)    Serial.print("GNSS");
   else if (rmc.source == nmea::RmcSource::BDS)     Serial.print("BDS");
+  else if (rmc.source == nmea::RmcSource::QZSS)    Serial.print("QZSS");
 
   Serial.print(" ");
   Serial.print(rmc.time_utc.hour);
@@ -98,6 +99,7 @@ void onGgaUpdate(nmea::GgaData const gga)
   else if (gga.source == nmea::GgaSource::Galileo) Serial.print("Galileo");
   else if (gga.source == nmea::GgaSource::GNSS)    Serial.print("GNSS");
   else if (gga.source == nmea::GgaSource::BDS)     Serial.print("BDS");
+  else if (gga.source == nmea::GgaSource::QZSS)    Serial.print("QZSS");
 
   Serial.print(" ");
   Serial.print(gga.time_utc.hour);
@@ -0,0 +1,90 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef NMEA_BENCH_H_
+#define NMEA_BENCH_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdio.h>
+
+#include <chrono>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace bench
+{
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+/* Returns the wall clock time in seconds it takes to execute 'func' 'iterations' times. */
+template <typename Func>
+double measure(size_t const iterations, Func func)
+{
+  auto const start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; i++)
+    func();
+  auto const stop = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+/* Output format of all results, Csv is meant for tracking
+ * the results over releases by scripts.
+ */
+enum class Format { Text, Csv };
+
+inline Format & outputFormat()
+{
+  static Format format = Format::Text;
+  return format;
+}
+
+inline void print(char const * name, double const value, char const * unit)
+{
+  if (outputFormat() == Format::Csv)
+    printf("\"%s\",%.3f,%s\n", name, value, unit);
+  else
+    printf("%-40s %12.2f %s\n", name, value, unit);
+}
+
+inline void report(char const * name, double const bytes_per_sec)
+{
+  print(name, bytes_per_sec / (1024.0 * 1024.0), "MB/s");
+}
+
+inline void reportCall(char const * name, double const sec_per_call)
+{
+  print(name, sec_per_call * 1e9, "ns/call");
+}
+
+inline void reportRate(char const * name, double const sentences_per_sec)
+{
+  print(name, sentences_per_sec, "sentences/s");
+}
+
+/**************************************************************************************
+ * FUNCTION DECLARATION
+ **************************************************************************************/
+
+void bench_encode();
+void bench_numeric();
+void bench_corpus(char const * corpus_path);
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* bench */
+
+#endif /* NMEA_BENCH_H_ */
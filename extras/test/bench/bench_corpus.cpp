@@ -0,0 +1,223 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "bench.h"
+
+#include <map>
+#include <limits>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include <ArduinoNmeaParser.h>
+
+#include <nmea/GxRMC.h>
+#include <nmea/GxGGA.h>
+#include <nmea/util/checksum.h>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace bench
+{
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+static size_t const STREAM_SIZE     = 1024 * 1024;
+static size_t const ITERATIONS      = 10;
+static size_t const CALL_ITERATIONS = 100;
+static size_t const WCET_ITERATIONS = 20;
+
+/* Consumes the results so that the compiler can not optimize the calls away. */
+static volatile bool    sink_bool;
+static volatile int32_t sink_int32;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+/* The corpus is stored with Unix line endings, the '\r' required
+ * by the NMEA standard is added while loading it.
+ */
+static std::vector<std::string> loadCorpus(char const * corpus_path)
+{
+  std::vector<std::string> corpus;
+  std::ifstream file(corpus_path);
+
+  for (std::string line; std::getline(file, line); )
+  {
+    if (!line.empty() && line.back() == '\r')
+      line.pop_back();
+    if (!line.empty())
+      corpus.push_back(line + "\r\n");
+  }
+
+  return corpus;
+}
+
+/* Concatenates 'nmea' until the stream reaches STREAM_SIZE,
+ * the number of contained NMEA messages is stored in 'num_sentences'.
+ */
+static std::string makeStream(std::vector<std::string> const & nmea, size_t & num_sentences)
+{
+  std::string stream;
+  for (num_sentences = 0; stream.length() < STREAM_SIZE; num_sentences++)
+    stream += nmea[num_sentences % nmea.size()];
+  return stream;
+}
+
+static void bench_encode_corpus(std::vector<std::string> const & corpus)
+{
+  size_t num_sentences = 0;
+  std::string const stream = makeStream(corpus, num_sentences);
+
+  double const bytes     = static_cast<double>(stream.length() * ITERATIONS);
+  double const sentences = static_cast<double>(num_sentences   * ITERATIONS);
+
+  {
+    ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+    double const t = measure(ITERATIONS, [&]()
+    {
+      for (char const c : stream)
+        parser.encode(c);
+    });
+    report    ("corpus encode(char)", bytes / t);
+    reportRate("corpus encode(char)", sentences / t);
+  }
+
+  {
+    ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+    double const t = measure(ITERATIONS, [&]() { parser.encode(stream.data(), stream.length()); });
+    report    ("corpus encode(char const *, len)", bytes / t);
+    reportRate("corpus encode(char const *, len)", sentences / t);
+  }
+}
+
+/* Each NMEA message type is fed separately through the parser to
+ * expose the cost of the individual decoders (or the lack thereof).
+ */
+static void bench_encode_per_type(std::vector<std::string> const & corpus)
+{
+  std::map<std::string, std::vector<std::string>> corpus_per_type;
+  for (std::string const & nmea : corpus)
+    corpus_per_type[nmea.substr(3, 3)].push_back(nmea);
+
+  for (auto const & type : corpus_per_type)
+  {
+    size_t num_sentences = 0;
+    std::string const stream = makeStream(type.second, num_sentences);
+
+    ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+    double const t = measure(ITERATIONS, [&]() { parser.encode(stream.data(), stream.length()); });
+
+    std::string const name = "corpus " + type.first + " encode(char const *, len)";
+    reportRate(name.c_str(), static_cast<double>(num_sentences * ITERATIONS) / t);
+  }
+}
+
+static void bench_isChecksumOk(std::vector<std::string> const & corpus)
+{
+  double const t = measure(CALL_ITERATIONS, [&]()
+  {
+    for (std::string const & nmea : corpus)
+      sink_bool = nmea::util::isChecksumOk(nmea.c_str());
+  });
+
+  reportCall("corpus isChecksumOk", t / (CALL_ITERATIONS * corpus.size()));
+}
+
+template <typename Data, typename Parse>
+static void bench_parse(char const * name, std::vector<std::string> const & corpus, char const * formatter, Data data, Parse parse)
+{
+  std::vector<std::string> nmea;
+  for (std::string const & n : corpus)
+    if (n.compare(3, 3, formatter) == 0)
+      nmea.push_back(n);
+
+  if (nmea.empty())
+    return;
+
+  double const t = measure(CALL_ITERATIONS, [&]()
+  {
+    for (std::string const & n : nmea)
+    {
+      parse(n.c_str(), data);
+      sink_int32 = data.latitude_e7;
+    }
+  });
+
+  reportCall(name, t / (CALL_ITERATIONS * nmea.size()));
+}
+
+/* Worst case execution time of a single encode(char) call. Every
+ * call is timed on its own and the minimum over all iterations is
+ * taken per character in order to filter out interrupts and
+ * preemption, the maximum over all characters of the corpus is
+ * reported. The cost of reading the clock is included.
+ */
+template <typename Setup>
+static void bench_wcet(char const * name, std::vector<std::string> const & corpus, Setup setup)
+{
+  std::string stream;
+  for (std::string const & nmea : corpus)
+    stream += nmea;
+
+  std::vector<double> duration(stream.length(), std::numeric_limits<double>::max());
+
+  for (size_t i = 0; i < WCET_ITERATIONS; i++)
+  {
+    ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+    setup(parser);
+    for (size_t c = 0; c < stream.length(); c++)
+    {
+      char const ch = stream[c];
+      duration[c] = std::min(duration[c], measure(1, [&]() { parser.encode(ch); }));
+    }
+  }
+
+  double sum = 0.0;
+  for (double const d : duration)
+    sum += d;
+
+  std::string const max_name = std::string(name) + " max";
+  std::string const avg_name = std::string(name) + " avg";
+  reportCall(max_name.c_str(), *std::max_element(duration.begin(), duration.end()));
+  reportCall(avg_name.c_str(), sum / duration.size());
+}
+
+void bench_corpus(char const * corpus_path)
+{
+  std::vector<std::string> const corpus = loadCorpus(corpus_path);
+
+  if (corpus.empty())
+  {
+    fprintf(stderr, "error: could not load NMEA corpus from '%s'\n", corpus_path);
+    return;
+  }
+
+  bench_encode_corpus(corpus);
+  bench_encode_per_type(corpus);
+  bench_isChecksumOk(corpus);
+  bench_parse("corpus GxRMC::parse", corpus, "RMC", nmea::INVALID_RMC, [](char const * n, nmea::RmcData & d) { nmea::GxRMC::parse(n, d); });
+  bench_parse("corpus GxGGA::parse", corpus, "GGA", nmea::INVALID_GGA, [](char const * n, nmea::GgaData & d) { nmea::GxGGA::parse(n, d); });
+  bench_wcet("corpus wcet encode(char)", corpus, [](ArduinoNmeaParser &) { });
+  bench_wcet("corpus wcet encode(char) streaming", corpus, [](ArduinoNmeaParser & parser) { parser.setStreamingDecode(true); });
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* bench */
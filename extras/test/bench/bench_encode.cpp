@@ -0,0 +1,102 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "bench.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace bench
+{
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+/* Decoded NMEA messages. */
+static std::vector<std::string> const NMEA_DECODED =
+{
+  "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n",
+  "$GPGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7A\r\n",
+  "$GPRMC,142600.00,A,4837.99474,N,01301.53452,E,27.920,247.03,121020,,,A*5A\r\n",
+  "$GPRMC,052853.105,A,5230.888,N,01320.967,E,084.5,069.2,080720,000.0,W*7A\r\n",
+};
+
+/* NMEA messages which are framed but not decoded, this isolates the framing cost. */
+static std::vector<std::string> const NMEA_FRAMED =
+{
+  "$GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00*74\r\n",
+  "$GPGSV,3,2,11,14,25,170,00,16,57,208,39,18,67,296,40,19,40,246,00*74\r\n",
+  "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n",
+  "$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48\r\n",
+};
+
+static size_t const STREAM_SIZE = 1024 * 1024;
+static size_t const ITERATIONS  = 10;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static std::string makeStream(std::vector<std::string> const & nmea)
+{
+  std::string stream;
+  for (size_t i = 0; stream.length() < STREAM_SIZE; i++)
+    stream += nmea[i % nmea.size()];
+  return stream;
+}
+
+static void bench_encode(char const * stream_name, std::string const & stream)
+{
+  double const bytes = static_cast<double>(stream.length() * ITERATIONS);
+
+  {
+    ArduinoNmeaParser parser(nullptr, nullptr);
+    double const t = measure(ITERATIONS, [&]()
+    {
+      for (char const c : stream)
+        parser.encode(c);
+    });
+    std::string const name = std::string(stream_name) + " encode(char)";
+    report(name.c_str(), bytes / t);
+  }
+
+  for (size_t const chunk_size : {16, 64, 256, 1024})
+  {
+    ArduinoNmeaParser parser(nullptr, nullptr);
+    double const t = measure(ITERATIONS, [&]()
+    {
+      for (size_t offset = 0; offset < stream.length(); offset += chunk_size)
+        parser.encode(stream.data() + offset, std::min(chunk_size, stream.length() - offset));
+    });
+    std::string const name = std::string(stream_name) + " encode(char const *, " + std::to_string(chunk_size) + ")";
+    report(name.c_str(), bytes / t);
+  }
+}
+
+void bench_encode()
+{
+  bench_encode("decoded", makeStream(NMEA_DECODED));
+  bench_encode("framed ", makeStream(NMEA_FRAMED));
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* bench */
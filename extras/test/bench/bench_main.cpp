@@ -0,0 +1,50 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "bench.h"
+
+#include <string.h>
+
+/**************************************************************************************
+ * MAIN
+ **************************************************************************************/
+
+/* Usage: benchNmeaParser [--csv] [--corpus <file>]
+ *
+ *   --csv    print one "name",value,unit line per result
+ *   --corpus NMEA log used for the corpus benchmarks, defaults
+ *            to the bundled multi-constellation log.
+ */
+int main(int argc, char ** argv)
+{
+  char const * corpus_path = NMEA_BENCH_CORPUS;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--csv"))
+      bench::outputFormat() = bench::Format::Csv;
+    else if (!strcmp(argv[i], "--corpus") && (i + 1) < argc)
+      corpus_path = argv[++i];
+    else
+    {
+      fprintf(stderr, "usage: %s [--csv] [--corpus <file>]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  if (bench::outputFormat() == bench::Format::Csv)
+    printf("name,value,unit\n");
+
+  bench::bench_encode();
+  bench::bench_corpus(corpus_path);
+  bench::bench_numeric();
+  return 0;
+}
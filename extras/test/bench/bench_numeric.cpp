@@ -0,0 +1,112 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+#include <nmea/util/numeric.h>
+#include <nmea/util/common.h>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace bench
+{
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+static size_t const ITERATIONS = 1000 * 1000;
+
+/* Consumes the results so that the compiler can not optimize the calls away. */
+static volatile float sink_float;
+static volatile int   sink_int;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+/* Fields are benchmarked in place within a NMEA message, just
+ * like atof/atoi would be called from within the decoders.
+ */
+static void bench_float(char const * field_name, char const * nmea, size_t const token_len)
+{
+  /* Use a runtime copy of the token to prevent constant folding. */
+  std::string const token(nmea);
+
+  double const t_atof = measure(ITERATIONS, [&]() { sink_float = static_cast<float>(atof(token.c_str())); });
+  double const t_kern = measure(ITERATIONS, [&]() { sink_float = nmea::util::parseFloat(token.c_str(), token_len); });
+
+  reportCall((std::string(field_name) + " atof"      ).c_str(), t_atof / ITERATIONS);
+  reportCall((std::string(field_name) + " parseFloat").c_str(), t_kern / ITERATIONS);
+}
+
+static void bench_int(char const * field_name, char const * nmea, size_t const token_len)
+{
+  std::string const token(nmea);
+
+  double const t_atoi = measure(ITERATIONS, [&]() { sink_int = atoi(token.c_str()); });
+  double const t_kern = measure(ITERATIONS, [&]() { sink_int = nmea::util::parseInt(token.c_str(), token_len); });
+
+  reportCall((std::string(field_name) + " atoi"    ).c_str(), t_atoi / ITERATIONS);
+  reportCall((std::string(field_name) + " parseInt").c_str(), t_kern / ITERATIONS);
+}
+
+static void bench_coordinate()
+{
+  std::string const lat("5230.868,N");
+  std::string const lon("01320.958,E");
+
+  double const t_lat = measure(ITERATIONS, [&]() { sink_float = nmea::util::parseLatitude (lat.c_str(), 8); });
+  double const t_lon = measure(ITERATIONS, [&]() { sink_float = nmea::util::parseLongitude(lon.c_str(), 9); });
+
+  reportCall("latitude parseLatitude",   t_lat / ITERATIONS);
+  reportCall("longitude parseLongitude", t_lon / ITERATIONS);
+}
+
+static void bench_time()
+{
+  std::string const time("052852.105,A");
+
+  double const t = measure(ITERATIONS, [&]()
+  {
+    nmea::Time time_utc;
+    nmea::util::parseTime(time.c_str(), 10, time_utc);
+    sink_int = time_utc.microsecond;
+  });
+
+  reportCall("time parseTime", t / ITERATIONS);
+}
+
+void bench_numeric()
+{
+  bench_float("speed",    "077.0,023.5",  5);
+  bench_float("course",   "023.5,080720", 5);
+  bench_float("hdop",     "2.4,454.7",    3);
+  bench_float("altitude", "454.7,M",      5);
+  bench_float("minutes",  "30.868,N",     6);
+  bench_int  ("num_sats", "05,2.4",       2);
+  bench_int  ("dgps_age", "0000*7A",      4);
+  bench_coordinate();
+  bench_time();
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* bench */
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+#
+# This software is distributed under the terms of the MIT License.
+# Copyright (c) 2020 LXRobotics.
+# Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+# Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+#
+# Generates the synthetic benchmark corpus multi_constellation.nmea.
+#
+# The output mimics the NMEA 4.11 output of a multi-constellation
+# receiver at 1 Hz (RMC, VTG, GGA, one GSA per constellation, GSV for
+# GPS/GLONASS/Galileo/BeiDou, GLL and a ZDA once per minute) for a
+# vehicle moving at roughly 12 kn. It is NOT a receiver capture: the
+# message mix, field widths and message lengths are representative,
+# the satellite geometry and the motion are made up. A fixed seed makes
+# the output reproducible.
+#
+# Usage: generate_corpus.py > multi_constellation.nmea
+
+import math
+import random
+
+SEED = 107
+NUM_EPOCHS = 120
+
+START_HOUR, START_MINUTE = 10, 41
+DAY, MONTH, YEAR = 8, 7, 2020
+
+START_LAT = 52.0 + 30.8892 / 60.0
+START_LON = 13.0 + 20.958 / 60.0
+
+# Talker, NMEA 4.11 system id, GSV signal id, satellite ids.
+CONSTELLATIONS = [
+    ("GP", 1, 1, [2, 5, 7, 13, 14, 15, 18, 20, 23, 27, 30]),
+    ("GL", 2, 1, [65, 66, 72, 73, 80, 81, 88]),
+    ("GA", 3, 7, [3, 5, 8, 13, 15, 24, 25, 31, 34]),
+    ("GB", 4, 1, [6, 9, 14, 19, 20, 22, 26, 28, 36, 39]),
+]
+
+
+def checksum(body):
+    cs = 0
+    for c in body:
+        cs ^= ord(c)
+    return cs
+
+
+def sentence(body):
+    return "$%s*%02X" % (body, checksum(body))
+
+
+def nmea_lat(lat):
+    deg = int(lat)
+    return "%02d%08.5f,%s" % (deg, (lat - deg) * 60.0, "N" if lat >= 0 else "S")
+
+
+def nmea_lon(lon):
+    deg = int(lon)
+    return "%03d%08.5f,%s" % (deg, (lon - deg) * 60.0, "E" if lon >= 0 else "W")
+
+
+def main():
+    rng = random.Random(SEED)
+
+    # Initial elevation/azimuth per satellite, drifting slowly per epoch.
+    sky = {}
+    for talker, _, _, ids in CONSTELLATIONS:
+        for sat in ids:
+            sky[(talker, sat)] = [rng.uniform(1.0, 85.0), rng.uniform(0.0, 360.0)]
+
+    lat, lon = START_LAT, START_LON
+    speed_kn, course = 12.0, 70.0
+
+    for epoch in range(NUM_EPOCHS):
+        seconds = START_HOUR * 3600 + START_MINUTE * 60 + epoch
+        utc = "%02d%02d%02d.00" % (seconds // 3600, (seconds // 60) % 60, seconds % 60)
+        date = "%02d%02d%02d" % (DAY, MONTH, YEAR % 100)
+
+        speed_kn = min(max(speed_kn + rng.uniform(-0.6, 0.6), 8.0), 16.0)
+        course = (course + rng.uniform(-2.5, 2.5)) % 360.0
+
+        # Satellites tracked this epoch, None denoting no C/N0.
+        snr = {key: (rng.randint(20, 49) if rng.random() < 0.75 else None) for key in sky}
+        used = {talker: [sat for sat in ids if snr[(talker, sat)] is not None][:12] for talker, _, _, ids in CONSTELLATIONS}
+        num_used = sum(len(u) for u in used.values())
+
+        pdop = rng.uniform(1.2, 2.0)
+        hdop = rng.uniform(0.7, 1.3)
+        vdop = rng.uniform(0.9, 1.6)
+
+        print(sentence("GNRMC,%s,A,%s,%s,%.3f,%.2f,%s,,,A,V" % (utc, nmea_lat(lat), nmea_lon(lon), speed_kn, course, date)))
+        print(sentence("GNVTG,%.2f,T,,M,%.3f,N,%.3f,K,A" % (course, speed_kn, speed_kn * 1.852)))
+        print(sentence("GNGGA,%s,%s,%s,1,%02d,%.2f,%.1f,M,44.9,M,," % (utc, nmea_lat(lat), nmea_lon(lon), min(num_used, 99), hdop, 34.5 + rng.uniform(-0.5, 0.5))))
+
+        for talker, system_id, _, _ in CONSTELLATIONS:
+            ids = ["%02d" % sat for sat in used[talker]] + [""] * (12 - len(used[talker]))
+            print(sentence("GNGSA,A,3,%s,%.2f,%.2f,%.2f,%d" % (",".join(ids), pdop, hdop, vdop, system_id)))
+
+        for talker, _, signal_id, ids in CONSTELLATIONS:
+            num_messages = (len(ids) + 3) // 4
+            for m in range(num_messages):
+                fields = []
+                for sat in ids[m * 4:(m + 1) * 4]:
+                    elevation, azimuth = sky[(talker, sat)]
+                    cn0 = snr[(talker, sat)]
+                    fields.append("%02d,%02d,%03d,%s" % (sat, int(elevation), int(azimuth), "" if cn0 is None else "%02d" % cn0))
+                print(sentence("%sGSV,%d,%d,%02d,%s,%d" % (talker, num_messages, m + 1, len(ids), ",".join(fields), signal_id)))
+
+        print(sentence("GNGLL,%s,%s,%s,A,A" % (nmea_lat(lat), nmea_lon(lon), utc)))
+        if epoch % 60 == 0:
+            print(sentence("GNZDA,%s,%02d,%02d,%04d,00,00" % (utc, DAY, MONTH, YEAR)))
+
+        # Dead reckoning of the next position.
+        distance_m = speed_kn * 1852.0 / 3600.0
+        lat += distance_m * math.cos(math.radians(course)) / 111320.0
+        lon += distance_m * math.sin(math.radians(course)) / (111320.0 * math.cos(math.radians(lat)))
+
+        for key, position in sky.items():
+            position[0] = min(max(position[0] + rng.uniform(-0.05, 0.05), 0.0), 89.0)
+            position[1] = (position[1] + rng.uniform(0.0, 0.1)) % 360.0
+
+
+if __name__ == "__main__":
+    main()
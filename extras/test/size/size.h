@@ -0,0 +1,53 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_TEST_SIZE_H_
+#define ARDUINO_NMEA_TEST_SIZE_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdio.h>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+/* Keeps the decoded data observable so that the compiler can not
+ * discard the decoders which are actually in use.
+ */
+static volatile int32_t sink;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+inline void onRmcUpdate(nmea::RmcData const & rmc, void * /* context */)
+{
+  sink = rmc.latitude_e7;
+}
+
+inline void onGgaUpdate(nmea::GgaData const & gga, void * /* context */)
+{
+  sink = gga.latitude_e7;
+}
+
+/* Minimal sketch-like main loop: all characters read from stdin
+ * are fed into the parser one at a time.
+ */
+template <typename Parser>
+int feed(Parser & parser)
+{
+  for (int c = getchar(); c != EOF; c = getchar())
+    parser.encode(static_cast<char>(c));
+  return 0;
+}
+
+#endif /* ARDUINO_NMEA_TEST_SIZE_H_ */
@@ -0,0 +1,29 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "size.h"
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static nmea::NmeaParser<nmea::Rmc, nmea::Gga> parser;
+
+/**************************************************************************************
+ * MAIN
+ **************************************************************************************/
+
+int main()
+{
+  parser.onUpdate<nmea::Rmc>(onRmcUpdate);
+  parser.onUpdate<nmea::Gga>(onGgaUpdate);
+  return feed(parser);
+}
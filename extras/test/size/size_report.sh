@@ -0,0 +1,25 @@
+#!/bin/sh
+#
+# Prints the flash (text) and RAM (data + bss) footprint of the size
+# programs and verifies that the decoders which have not been selected
+# via nmea::NmeaParser<...> have been stripped from the binary.
+#
+# Usage: size_report.sh <directory containing the size programs>
+
+BIN_DIR=$1
+
+size "$BIN_DIR/sizeArduinoNmeaParser" "$BIN_DIR/sizeNmeaParserRmcGga" "$BIN_DIR/sizeNmeaParserRmc" || exit 1
+
+for SYMBOL in "nmea::GxGGA::" "nmea::GxGSA::" "nmea::GxGSV::" "SkyViewAssembler"; do
+  if nm -C "$BIN_DIR/sizeNmeaParserRmc" | grep -q "$SYMBOL"; then
+    echo "error: sizeNmeaParserRmc contains $SYMBOL"
+    exit 1
+  fi
+done
+
+if ! nm -C "$BIN_DIR/sizeNmeaParserRmcGga" | grep -q "nmea::GxGGA::"; then
+  echo "error: sizeNmeaParserRmcGga does not contain the GGA decoder"
+  exit 1
+fi
+
+echo "GGA, GSA and GSV decoders are only linked when selected"
@@ -0,0 +1,202 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+static std::string const GNGGA = "$GNGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*64\r\n";
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* Records all callbacks in the order of their invocation,
+ * 'position' being the number of characters encoded so far.
+ */
+typedef struct
+{
+  std::string event;
+  size_t position;
+  nmea::RmcData rmc;
+  nmea::GgaData gga;
+} Record;
+
+typedef struct
+{
+  std::vector<Record> records;
+  size_t position;
+} Recorder;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static void record(Recorder & recorder, std::string const & event, nmea::RmcData const & rmc, nmea::GgaData const & gga)
+{
+  recorder.records.push_back(Record{event, recorder.position, rmc, gga});
+}
+
+static void onRmcProvisional(nmea::RmcData const & rmc, nmea::Provisional const available, void * context)
+{
+  record(*static_cast<Recorder *>(context), (available == nmea::Provisional::Time) ? "rmc-time" : "rmc-position", rmc, nmea::INVALID_GGA);
+}
+
+static void onGgaProvisional(nmea::GgaData const & gga, nmea::Provisional const available, void * context)
+{
+  record(*static_cast<Recorder *>(context), (available == nmea::Provisional::Time) ? "gga-time" : "gga-position", nmea::INVALID_RMC, gga);
+}
+
+static void onVerdict(nmea::Verdict const verdict, void * context)
+{
+  record(*static_cast<Recorder *>(context), (verdict == nmea::Verdict::Confirmed) ? "confirmed" : "retracted", nmea::INVALID_RMC, nmea::INVALID_GGA);
+}
+
+static void onRmcUpdate(nmea::RmcData const & rmc, void * context)
+{
+  record(*static_cast<Recorder *>(context), "rmc", rmc, nmea::INVALID_GGA);
+}
+
+static void onGgaUpdate(nmea::GgaData const & gga, void * context)
+{
+  record(*static_cast<Recorder *>(context), "gga", nmea::INVALID_RMC, gga);
+}
+
+static void encode(ArduinoNmeaParser & parser, Recorder & recorder, std::string const & nmea)
+{
+  for (char const c : nmea)
+  {
+    recorder.position++;
+    parser.encode(c);
+  }
+}
+
+static std::vector<std::string> events(Recorder const & recorder)
+{
+  std::vector<std::string> events;
+  for (Record const & r : recorder.records)
+    events.push_back(r.event);
+  return events;
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Time and position are delivered before the checksum arrives", "[EarlyDispatch-01]")
+{
+  Recorder recorder{{}, 0};
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &recorder);
+  parser.setEarlyDispatch(onRmcProvisional, onGgaProvisional, onVerdict);
+
+  encode(parser, recorder, GPRMC + GNGGA);
+
+  REQUIRE(events(recorder) == std::vector<std::string>{"rmc-time", "rmc-position", "confirmed", "rmc",
+                                                       "gga-time", "gga-position", "confirmed", "gga"});
+
+  /* The time is available with the ',' following it. */
+  REQUIRE(recorder.records[0].position == GPRMC.find(",A,") + 1);
+  REQUIRE(recorder.records[0].rmc.time_utc.hour   == 5);
+  REQUIRE(recorder.records[0].rmc.time_utc.minute == 28);
+  REQUIRE(recorder.records[0].rmc.time_utc.second == 52);
+  REQUIRE(recorder.records[0].rmc.received.first_byte == 0);
+
+  REQUIRE(recorder.records[1].position == GPRMC.find(",077.0") + 1);
+  REQUIRE(recorder.records[1].rmc.latitude_e7  == 525144667);
+  REQUIRE(recorder.records[1].rmc.longitude_e7 == 133493000);
+  REQUIRE(recorder.records[1].rmc.source       == nmea::RmcSource::GPS);
+
+  REQUIRE(recorder.records[3].position == GPRMC.length());
+  REQUIRE(recorder.records[3].rmc.latitude_e7 == recorder.records[1].rmc.latitude_e7);
+
+  REQUIRE(recorder.records[4].gga.time_utc.hour == 11);
+  REQUIRE(recorder.records[5].gga.source        == nmea::GgaSource::GNSS);
+  REQUIRE(recorder.records[5].gga.latitude_e7   == recorder.records[7].gga.latitude_e7);
+}
+
+TEST_CASE("Provisional data is retracted if the NMEA message is not confirmed", "[EarlyDispatch-02]")
+{
+  Recorder recorder{{}, 0};
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &recorder);
+  parser.setEarlyDispatch(onRmcProvisional, onGgaProvisional, onVerdict);
+
+  WHEN("the checksum does not match")
+  {
+    encode(parser, recorder, "$GPRMC,052856.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000.0,W*FF\r\n");
+    REQUIRE(events(recorder) == std::vector<std::string>{"rmc-time", "rmc-position", "retracted"});
+    REQUIRE(parser.error() == ArduinoNmeaParser::Error::Checksum);
+    REQUIRE_FALSE(parser.rmc().is_valid);
+  }
+
+  WHEN("the NMEA message is truncated by the start of the next one")
+  {
+    encode(parser, recorder, GPRMC.substr(0, 20) + GNGGA);
+    REQUIRE(events(recorder) == std::vector<std::string>{"rmc-time", "retracted", "gga-time", "gga-position", "confirmed", "gga"});
+    REQUIRE(parser.statistics().framed_messages == 1);
+  }
+
+  WHEN("the NMEA message is terminated early")
+  {
+    encode(parser, recorder, GPRMC.substr(0, 20) + "\r\n");
+    REQUIRE(events(recorder) == std::vector<std::string>{"rmc-time", "retracted"});
+  }
+
+  WHEN("the NMEA message overflows the parse buffer")
+  {
+    encode(parser, recorder, GPRMC.substr(0, 60) + GPRMC.substr(7, 60));
+    REQUIRE(events(recorder) == std::vector<std::string>{"rmc-time", "rmc-position", "retracted"});
+    REQUIRE(parser.statistics().overflows == 1);
+  }
+}
+
+TEST_CASE("Early dispatch yields the same events for encoding a whole buffer", "[EarlyDispatch-03]")
+{
+  std::string const stream = GPRMC + "$GPRMC,0528" + GNGGA + GPRMC;
+
+  Recorder per_char{{}, 0};
+  ArduinoNmeaParser per_char_parser(onRmcUpdate, onGgaUpdate, &per_char);
+  per_char_parser.setEarlyDispatch(onRmcProvisional, onGgaProvisional, onVerdict);
+  encode(per_char_parser, per_char, stream);
+
+  Recorder bulk{{}, 0};
+  ArduinoNmeaParser bulk_parser(onRmcUpdate, onGgaUpdate, &bulk);
+  bulk_parser.setEarlyDispatch(onRmcProvisional, onGgaProvisional, onVerdict);
+  bulk_parser.encode(stream.c_str(), stream.length());
+
+  REQUIRE(events(bulk) == events(per_char));
+  REQUIRE(bulk_parser.statistics().framed_messages == per_char_parser.statistics().framed_messages);
+  REQUIRE(bulk_parser.discardedBytes() == per_char_parser.discardedBytes());
+}
+
+TEST_CASE("Early dispatch is disabled by default and can be disabled again", "[EarlyDispatch-04]")
+{
+  Recorder recorder{{}, 0};
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &recorder);
+
+  encode(parser, recorder, GPRMC);
+  REQUIRE(events(recorder) == std::vector<std::string>{"rmc"});
+
+  parser.setEarlyDispatch(onRmcProvisional, nullptr, onVerdict);
+  encode(parser, recorder, GPRMC + GNGGA);
+  REQUIRE(events(recorder) == std::vector<std::string>{"rmc", "rmc-time", "rmc-position", "confirmed", "rmc", "gga"});
+
+  parser.setEarlyDispatch(nullptr, nullptr, nullptr);
+  encode(parser, recorder, GPRMC);
+  REQUIRE(events(recorder).size() == 7);
+}
@@ -0,0 +1,106 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const NMEA_STREAM =
+  std::string("garbage without start marker\r\n") +
+  "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n" +
+  "$GPRMC,052853.105,A,5230.888,N,0132" +
+  "$GPGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7A\r\n" +
+  "$GPRMC,052854.105,A,5230.901,N,01321.000,E,085.8,099.8,080720,000.0,W*7D\r" +
+  "noise" +
+  "$GPRMC,052855.105,A,5230.894,N,01321.038,E,084.3,138.7,080720,000.0,W*75\r\n" +
+  "$GPRMC,052856.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000.0,W\r\n" +
+  "$GPRMC,052858.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000000000000000.0,W*78\r\n" +
+  "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n" +
+  "$GPGGA,111909.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7B\r\n";
+
+static std::vector<int> rmc_seconds;
+static std::vector<int> gga_seconds;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static void onRmcUpdate(nmea::RmcData const data)
+{
+  rmc_seconds.push_back(data.time_utc.second);
+}
+
+static void onGgaUpdate(nmea::GgaData const data)
+{
+  gga_seconds.push_back(data.time_utc.second);
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Encoding whole buffers yields the same NMEA messages as encoding single characters", "[EncodeBuffer-01]")
+{
+  rmc_seconds.clear();
+  gga_seconds.clear();
+
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate);
+  for (char const c : NMEA_STREAM)
+    parser.encode(c);
+
+  std::vector<int> const RMC_SECONDS_EXPECTED = rmc_seconds;
+  std::vector<int> const GGA_SECONDS_EXPECTED = gga_seconds;
+
+  REQUIRE(RMC_SECONDS_EXPECTED == std::vector<int>({52, 55, 52}));
+  REQUIRE(GGA_SECONDS_EXPECTED == std::vector<int>({8, 9}));
+
+  for (size_t chunk_size = 1; chunk_size <= NMEA_STREAM.length(); chunk_size++)
+  {
+    rmc_seconds.clear();
+    gga_seconds.clear();
+
+    ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate);
+
+    for (size_t offset = 0; offset < NMEA_STREAM.length(); offset += chunk_size)
+      parser.encode(NMEA_STREAM.data() + offset, std::min(chunk_size, NMEA_STREAM.length() - offset));
+
+    REQUIRE(parser.error() == ArduinoNmeaParser::Error::None);
+    REQUIRE(rmc_seconds    == RMC_SECONDS_EXPECTED);
+    REQUIRE(gga_seconds    == GGA_SECONDS_EXPECTED);
+  }
+}
+
+TEST_CASE("Encoding a uint8_t buffer", "[EncodeBuffer-02]")
+{
+  rmc_seconds.clear();
+
+  ArduinoNmeaParser parser(onRmcUpdate, nullptr);
+
+  std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+  parser.encode(reinterpret_cast<uint8_t const *>(GPRMC.data()), GPRMC.length());
+
+  REQUIRE(rmc_seconds == std::vector<int>({52}));
+}
+
+TEST_CASE("Encoding an empty buffer", "[EncodeBuffer-03]")
+{
+  ArduinoNmeaParser parser(nullptr, nullptr);
+  parser.encode(static_cast<char const *>(nullptr), 0);
+  REQUIRE(parser.error() == ArduinoNmeaParser::Error::None);
+}
@@ -0,0 +1,191 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+static std::string const GNGGA = "$GNGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*64\r\n";
+
+static std::string const NMEA_STREAM =
+  std::string("noise\r\n") +
+  GPRMC +
+  "$GPRMC,052853.105,A,5230.888,N,01320.967,E,084.5,069.2,080720,000.0,W*7A\r\n" +
+  GNGGA +
+  "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n" +
+  "$GPRMC,052856.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000.0,W*FF\r\n" + /* Checksum mismatch. */
+  "$GPRMC,052854.105,A,5230.901,N,01321.000,E,085.8,099.8,080720,000.0,W\r\n" +    /* Missing checksum. */
+  "$GPRMC,052853.105,A,5230.8" +                                                   /* Truncated message. */
+  "$GPRMC,052859.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000000000000.0,W*7E\r\n" + /* Too long. */
+  "$GPRMC,052855.105,A,5230.894,N,01321.038,E,084.3,138.7,080720,000.0,W*7G\r\n" +  /* Invalid checksum digit. */
+  "$GPGGA,111909.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7B\r\n" +
+  "$PUBX,41,1,0007,0003,19200,0*25\r\n" +
+  "$GPRMC,052855.105,A,5230.894,N,01321.038,E,084.3,138.7,080720,000.0,W*75\r\n";
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+typedef struct
+{
+  std::vector<int> seconds;
+  std::vector<int32_t> latitudes;
+  std::vector<char const *> sentences;
+  ArduinoNmeaParser * parser;
+} Decoded;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static void onRmcUpdate(nmea::RmcData const & rmc, void * context)
+{
+  Decoded * result = static_cast<Decoded *>(context);
+  result->seconds.push_back(rmc.time_utc.second);
+  result->latitudes.push_back(rmc.latitude_e7);
+  result->sentences.push_back(result->parser->sentence());
+}
+
+static void onGgaUpdate(nmea::GgaData const & gga, void * context)
+{
+  Decoded * result = static_cast<Decoded *>(context);
+  result->seconds.push_back(gga.time_utc.second);
+  result->latitudes.push_back(gga.latitude_e7);
+  result->sentences.push_back(result->parser->sentence());
+}
+
+static void requireSame(nmea::Statistics const & a, nmea::Statistics const & b)
+{
+  REQUIRE(a.received_bytes   == b.received_bytes);
+  REQUIRE(a.discarded_bytes  == b.discarded_bytes);
+  REQUIRE(a.framed_messages  == b.framed_messages);
+  REQUIRE(a.checksum_errors  == b.checksum_errors);
+  REQUIRE(a.overflows        == b.overflows);
+  REQUIRE(a.unknown_messages == b.unknown_messages);
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Encoding a circular buffer yields the same result as encoding each character", "[EncodeRing-01]")
+{
+  Decoded expected;
+  ArduinoNmeaParser reference(onRmcUpdate, onGgaUpdate, &expected);
+  expected.parser = &reference;
+  for (char const c : NMEA_STREAM)
+    reference.encode(c);
+
+  REQUIRE(expected.seconds == std::vector<int>{52, 53, 8, 9, 55});
+
+  std::mt19937 rng(42);
+
+  for (size_t const ring_size : {32, 64, 97, 256})
+  {
+    Decoded actual;
+    ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &actual);
+    actual.parser = &parser;
+
+    /* Emulates a DMA controller writing a random number of
+     * characters into the ring before each call.
+     */
+    std::vector<char> ring(ring_size);
+    size_t tail = 0, head = 0, written = 0;
+
+    while (written < NMEA_STREAM.length())
+    {
+      size_t const chunk = std::min<size_t>(std::uniform_int_distribution<size_t>(1, ring_size - 1)(rng), NMEA_STREAM.length() - written);
+      for (size_t i = 0; i < chunk; i++, written++)
+      {
+        ring[head] = NMEA_STREAM[written];
+        head = (head + 1) % ring_size;
+      }
+
+      parser.encodeRing(ring.data(), ring_size, tail, head);
+      tail = head;
+    }
+
+    REQUIRE(actual.seconds   == expected.seconds);
+    REQUIRE(actual.latitudes == expected.latitudes);
+    requireSame(parser.statistics(), reference.statistics());
+    REQUIRE(parser.discardedBytes() == reference.discardedBytes());
+  }
+}
+
+TEST_CASE("Only NMEA messages straddling the wrap point are copied", "[EncodeRing-02]")
+{
+  Decoded result;
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &result);
+  result.parser = &parser;
+
+  /* GNGGA wraps around, GPRMC is contiguous. */
+  std::vector<uint8_t> ring(256, 0);
+  size_t const tail = ring.size() - 30;
+  std::string const stream = GNGGA + GPRMC;
+  for (size_t i = 0; i < stream.length(); i++)
+    ring[(tail + i) % ring.size()] = stream[i];
+  size_t const head = (tail + stream.length()) % ring.size();
+
+  parser.encodeRing(ring.data(), ring.size(), tail, head, 1234);
+
+  REQUIRE(result.seconds == std::vector<int>{8, 52});
+
+  char const * ring_begin = reinterpret_cast<char const *>(ring.data());
+  char const * ring_end   = ring_begin + ring.size();
+  REQUIRE_FALSE((result.sentences[0] >= ring_begin && result.sentences[0] < ring_end));
+  REQUIRE(result.sentences[1] == ring_begin + (head - GPRMC.length()));
+
+  REQUIRE(parser.rmc().received.first_byte == 1234);
+  REQUIRE(parser.rmc().received.last_byte  == 1234);
+  REQUIRE(parser.gga().received.first_byte == 1234);
+}
+
+TEST_CASE("Encoding two segments", "[EncodeRing-03]")
+{
+  Decoded result;
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &result);
+  result.parser = &parser;
+
+  std::string const first  = GPRMC + GNGGA.substr(0, 10);
+  std::string const second = GNGGA.substr(10) + GPRMC;
+
+  parser.encodeSegments(first.c_str(), first.length(), second.c_str(), second.length());
+  parser.encodeSegments(nullptr, 0, GNGGA.c_str(), GNGGA.length());
+
+  REQUIRE(result.seconds == std::vector<int>{52, 8, 52, 8});
+  REQUIRE(result.sentences[0] == first.c_str());
+  REQUIRE(result.sentences[2] == second.c_str() + GNGGA.length() - 10);
+  REQUIRE(parser.statistics().framed_messages == 4);
+  REQUIRE(parser.discardedBytes() == 0);
+}
+
+TEST_CASE("Encoding a circular buffer with streaming decode enabled", "[EncodeRing-04]")
+{
+  Decoded result;
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &result);
+  result.parser = &parser;
+  parser.setStreamingDecode(true);
+
+  std::string const stream = GPRMC + GNGGA;
+  parser.encodeRing(stream.c_str(), stream.length(), 0, stream.length());
+
+  REQUIRE(result.seconds == std::vector<int>{52, 8});
+}
@@ -0,0 +1,192 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::vector<int> rmc_seconds;
+static std::vector<int> gga_seconds;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static void encode(ArduinoNmeaParser & parser, std::string const & nmea)
+{
+  std::for_each(std::begin(nmea),
+                std::end(nmea),
+                [&parser](char const c)
+                {
+                  parser.encode(c);
+                });
+}
+
+static void onRmcUpdate(nmea::RmcData const data)
+{
+  rmc_seconds.push_back(data.time_utc.second);
+}
+
+static void onGgaUpdate(nmea::GgaData const data)
+{
+  gga_seconds.push_back(data.time_utc.second);
+}
+
+static std::string withChecksum(std::string const & body)
+{
+  uint8_t checksum = 0;
+  for (char const c : body)
+    checksum ^= static_cast<uint8_t>(c);
+
+  char checksum_str[3] = {0};
+  snprintf(checksum_str, sizeof(checksum_str), "%02X", checksum);
+
+  return std::string("$") + body + "*" + checksum_str + "\r\n";
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Only complete NMEA messages are framed from a noisy stream", "[Framing-01]")
+{
+  rmc_seconds.clear();
+  gga_seconds.clear();
+
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate);
+
+  std::string const stream =
+    std::string("garbage without start marker\r\n") +
+    "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n" +
+    "$GPRMC,052853.105,A,5230.888,N,0132" /* Truncated message, restarted by the next '$'. */ +
+    "$GPGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7A\r\n" +
+    "$GPRMC,052854.105,A,5230.901,N,01321.000,E,085.8,099.8,080720,000.0,W*7D\r" /* Missing LF. */ +
+    "noise" +
+    "$GPRMC,052855.105,A,5230.894,N,01321.038,E,084.3,138.7,080720,000.0,W*75\r\n" +
+    "$GPRMC,052856.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000.0,W\r\n" /* Missing checksum. */ +
+    "$GPRMC,052857.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000.0,W*7G\r\n" /* Invalid checksum digit. */ +
+    "$GPRMC,052858.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000.0,W*78\n" /* Missing CR. */ +
+    "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+
+  encode(parser, stream);
+
+  REQUIRE(parser.error() == ArduinoNmeaParser::Error::None);
+  REQUIRE(rmc_seconds    == std::vector<int>({52, 55, 52}));
+  REQUIRE(gga_seconds    == std::vector<int>({8}));
+}
+
+TEST_CASE("Same NMEA messages are framed regardless of the position within the stream", "[Framing-02]")
+{
+  std::vector<std::string> const NMEA =
+  {
+    "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n",
+    "$GPGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7A\r\n",
+    "$GPRMC,052853.105,A,5230.888,N,01320.967,E,084.5,069.2,080720,000.0,W*7A\r\n",
+    "$GPRMC,052854.105,A,5230.901,N,01321.000,E,085.8,099.8,080720,000.0,W*7D\r\n",
+  };
+
+  for (size_t offset = 0; offset < NMEA[0].length(); offset++)
+  {
+    rmc_seconds.clear();
+    gga_seconds.clear();
+
+    ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate);
+
+    /* Start decoding somewhere within the first message. */
+    encode(parser, NMEA[0].substr(offset));
+    for (size_t i = 1; i < NMEA.size(); i++)
+      encode(parser, NMEA[i]);
+
+    std::vector<int> const RMC_SECONDS_EXPECTED = (offset == 0) ? std::vector<int>({52, 53, 54}) : std::vector<int>({53, 54});
+
+    REQUIRE(parser.error() == ArduinoNmeaParser::Error::None);
+    REQUIRE(rmc_seconds    == RMC_SECONDS_EXPECTED);
+    REQUIRE(gga_seconds    == std::vector<int>({8}));
+  }
+}
+
+TEST_CASE("NMEA messages exceeding the maximum length of 82 characters are discarded", "[Framing-03]")
+{
+  rmc_seconds.clear();
+
+  ArduinoNmeaParser parser(onRmcUpdate, nullptr);
+
+  /* Pad the magnetic variation field with leading zeros until the desired message length is reached. */
+  std::string const RMC_MAX_LEN = withChecksum("GPRMC,052859.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,00000000000.0,W");
+  std::string const RMC_TOO_LONG = withChecksum("GPRMC,052859.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000000000000.0,W");
+
+  REQUIRE(RMC_MAX_LEN.length()  == 82);
+  REQUIRE(RMC_TOO_LONG.length() == 83);
+
+  encode(parser, RMC_TOO_LONG);
+  REQUIRE(rmc_seconds.empty());
+
+  encode(parser, RMC_MAX_LEN);
+  REQUIRE(rmc_seconds == std::vector<int>({59}));
+}
+
+TEST_CASE("All characters not belonging to a complete NMEA message are counted as discarded", "[Framing-04]")
+{
+  std::string const RMC          = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+  std::string const GGA          = "$GPGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7A\r\n";
+  std::string const RMC_CHECKSUM = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*78\r\n";
+
+  /* Each of these is discarded as a whole. */
+  std::vector<std::string> const DISCARDED =
+  {
+    "garbage without start marker\r\n",
+    "$GPRMC,052853.105,A,5230.888,N,0132",
+    "$GPRMC,052854.105,A,5230.901,N,01321.000,E,085.8,099.8,080720,000.0,W*7D\rnoise",
+    "$GPRMC,052857.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000.0,W*7G\r\n",
+    withChecksum("GPRMC,052859.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000000000000.0,W"),
+  };
+
+  std::string stream;
+  size_t discarded_bytes = 0;
+  for (std::string const & d : DISCARDED)
+  {
+    stream += d + RMC + RMC_CHECKSUM + GGA;
+    discarded_bytes += d.length();
+  }
+
+  rmc_seconds.clear();
+  gga_seconds.clear();
+
+  WHEN("the stream is encoded character by character")
+  {
+    ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate);
+    encode(parser, stream);
+
+    REQUIRE(parser.discardedBytes() == discarded_bytes);
+    REQUIRE(rmc_seconds.size()      == DISCARDED.size());
+    REQUIRE(gga_seconds.size()      == DISCARDED.size());
+  }
+
+  WHEN("the stream is encoded at once")
+  {
+    ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate);
+    parser.encode(stream.c_str(), stream.length());
+
+    REQUIRE(parser.discardedBytes() == discarded_bytes);
+    REQUIRE(rmc_seconds.size()      == DISCARDED.size());
+    REQUIRE(gga_seconds.size()      == DISCARDED.size());
+  }
+}
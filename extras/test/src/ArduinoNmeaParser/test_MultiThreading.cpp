@@ -0,0 +1,121 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+#include <nmea/util/checksum.h>
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+static std::vector<std::string> const NMEA =
+{
+  "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n",
+  "$GPGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7A\r\n",
+  "$GPRMC,052853.105,A,5230.888,N,01320.967,E,084.5,069.2,080720,000.0,W*7A\r\n",
+  "$GPRMC,052854.105,A,5230.901,N,01321.000,E,085.8,099.8,080720,000.0,W\r\n", /* Missing checksum. */
+  "$GPRMC,052855.105,A,5230.894,N,01321.038,E,084.3,138.7,080720,000.0,W*75\r\n",
+  "$GPRMC,052856.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000.0,W*FF\r\n", /* Checksum mismatch. */
+  "$GPRMC,142600.00,A,4837.99474,N,01301.53452,E,27.920,247.03,121020,,,A*5A\r\n",
+  "$GPGGA,111909.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7B\r\n",
+};
+
+static size_t const NUM_THREADS = 8;
+static size_t const NUM_ROUNDS  = 200;
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+typedef struct
+{
+  std::vector<float> latitude;
+  std::vector<int>   second;
+  size_t             checksum_ok;
+} Result;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+/* Each stream contains the same NMEA messages, but starting at
+ * a different message and mixed with the messages of the other
+ * streams, so that every parser sees a different byte sequence.
+ */
+static std::string makeStream(size_t const stream_id)
+{
+  std::string stream;
+  for (size_t round = 0; round < NUM_ROUNDS; round++)
+    for (size_t i = 0; i < NMEA.size(); i++)
+      stream += NMEA[(stream_id + round * i) % NMEA.size()];
+  return stream;
+}
+
+static Result parse(std::string const & stream, size_t const chunk_size)
+{
+  Result result;
+  result.checksum_ok = 0;
+
+  ArduinoNmeaParser parser([&result](nmea::RmcData const rmc) { result.latitude.push_back(rmc.latitude); result.second.push_back(rmc.time_utc.second); },
+                           [&result](nmea::GgaData const gga) { result.latitude.push_back(gga.latitude); result.second.push_back(gga.time_utc.second); });
+
+  for (size_t offset = 0; offset < stream.length(); offset += chunk_size)
+    parser.encode(stream.data() + offset, std::min(chunk_size, stream.length() - offset));
+
+  for (std::string const & nmea : NMEA)
+    if (nmea::util::isChecksumOk(nmea.c_str()))
+      result.checksum_ok++;
+
+  return result;
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Parsing interleaved NMEA streams on multiple threads in parallel", "[MultiThreading-01]")
+{
+  std::vector<std::string> streams;
+  std::vector<Result> expected;
+
+  for (size_t t = 0; t < NUM_THREADS; t++)
+  {
+    streams.push_back(makeStream(t));
+    expected.push_back(parse(streams.back(), 1));
+  }
+
+  std::vector<Result> actual(NUM_THREADS);
+  std::vector<std::thread> threads;
+
+  for (size_t t = 0; t < NUM_THREADS; t++)
+    threads.emplace_back([t, &streams, &actual]()
+                         {
+                           actual[t] = parse(streams[t], 1 + t * 7);
+                         });
+
+  for (std::thread & thd : threads)
+    thd.join();
+
+  for (size_t t = 0; t < NUM_THREADS; t++)
+  {
+    REQUIRE(actual[t].latitude    == expected[t].latitude);
+    REQUIRE(actual[t].second      == expected[t].second);
+    REQUIRE(actual[t].checksum_ok == 6);
+    REQUIRE(actual[t].second.size() > 0);
+  }
+}
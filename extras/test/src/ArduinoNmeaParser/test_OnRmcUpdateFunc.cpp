@@ -75,3 +75,16 @@ TEST_CASE("Testing execution of OnRmcUpdateFunc when a full GxRMC message has be
   encode(parser, GPRMC);
   REQUIRE(on_rmc_update_called == true);
 }
+
+TEST_CASE("Accessing the raw NMEA message from within OnRmcUpdateFunc", "[OnRmcUpdateFunc-02]")
+{
+  std::string sentence;
+  ArduinoNmeaParser * parser_ptr = nullptr;
+
+  ArduinoNmeaParser parser([&](nmea::RmcData const) { sentence = parser_ptr->sentence(); }, nullptr);
+  parser_ptr = &parser;
+
+  std::string const GPRMC = ("$GPRMC,052856.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000.0,W*78\r\n");
+  encode(parser, GPRMC);
+  REQUIRE(sentence == GPRMC);
+}
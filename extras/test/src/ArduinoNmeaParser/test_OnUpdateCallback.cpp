@@ -0,0 +1,154 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+
+#include <new>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::atomic<size_t> num_allocations{0};
+
+static std::string const NMEA_STREAM =
+  "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n"
+  "$GPGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7A\r\n"
+  "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n"
+  "$GPRMC,052853.105,A,5230.888,N,01320.967,E,084.5,069.2,080720,000.0,W*7A\r\n"
+  "$GPRMC,052853.105,A,5230.888,N,01320.967,E,084.5,069.2,080720,000.0,W*00\r\n";
+
+/**************************************************************************************
+ * GLOBAL OPERATOR NEW/DELETE
+ **************************************************************************************/
+
+/* Count every heap allocation performed by this test executable. */
+
+void * operator new(size_t size)
+{
+  num_allocations++;
+  void * ptr = malloc(size ? size : 1);
+  if (!ptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void * ptr) noexcept
+{
+  free(ptr);
+}
+
+void operator delete(void * ptr, size_t) noexcept
+{
+  free(ptr);
+}
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+typedef struct
+{
+  std::vector<int> rmc_seconds;
+  std::vector<int> gga_seconds;
+} Context;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static void onRmcUpdate(nmea::RmcData const & rmc, void * context)
+{
+  static_cast<Context *>(context)->rmc_seconds.push_back(rmc.time_utc.second);
+}
+
+static void onGgaUpdate(nmea::GgaData const & gga, void * context)
+{
+  static_cast<Context *>(context)->gga_seconds.push_back(gga.time_utc.second);
+}
+
+static void onRmcUpdateCount(nmea::RmcData const & /* rmc */, void * context)
+{
+  (*static_cast<size_t *>(context))++;
+}
+
+static void onGgaUpdateCount(nmea::GgaData const & /* gga */, void * context)
+{
+  (*static_cast<size_t *>(context))++;
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Function pointer callbacks are invoked with the user supplied context", "[OnUpdateCallback-01]")
+{
+  Context context;
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &context);
+
+  parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+
+  REQUIRE(context.rmc_seconds == std::vector<int>({52, 53}));
+  REQUIRE(context.gga_seconds == std::vector<int>({8}));
+}
+
+TEST_CASE("Function pointer callbacks may be omitted", "[OnUpdateCallback-02]")
+{
+  ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+
+  parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+
+  REQUIRE(parser.rmc().time_utc.second == 53);
+  REQUIRE(parser.gga().time_utc.second == 8);
+}
+
+TEST_CASE("Decoding NMEA messages does not allocate any heap memory", "[OnUpdateCallback-03]")
+{
+  size_t num_updates = 0;
+
+  WHEN("function pointer callbacks are used")
+  {
+    ArduinoNmeaParser parser(onRmcUpdateCount, onGgaUpdateCount, &num_updates);
+
+    num_allocations = 0;
+    for (size_t i = 0; i < 100; i++)
+    {
+      for (char const c : NMEA_STREAM)
+        parser.encode(c);
+      parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+    }
+    size_t const allocations = num_allocations;
+
+    REQUIRE(num_updates == 100 * 2 * 3);
+    REQUIRE(allocations == 0);
+  }
+
+  WHEN("std::function callbacks capturing a reference are used")
+  {
+    ArduinoNmeaParser parser([&num_updates](nmea::RmcData const) { num_updates++; },
+                             [&num_updates](nmea::GgaData const) { num_updates++; });
+
+    num_allocations = 0;
+    for (size_t i = 0; i < 100; i++)
+      parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+    size_t const allocations = num_allocations;
+
+    REQUIRE(num_updates == 100 * 3);
+    REQUIRE(allocations == 0);
+  }
+}
@@ -0,0 +1,84 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+/* 108 characters, exceeds the standard limit of 82 characters. */
+static std::string const GPRMC_LONG  = "$GPRMC,052852.105,A,5230.86800000000000,N,01320.95800000000000,E,077.0000000,023.5000000,080720,000.0,W*79\r\n";
+/* 76 characters. */
+static std::string const GPRMC       = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+/* 25 characters. */
+static std::string const GPRMC_SHORT = "$GPRMC,,V,,,,,,,,,,N*53\r\n";
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Default parse buffer size discards messages exceeding 82 characters", "[ParseBufferSize-01]")
+{
+  ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+
+  parser.encode(GPRMC_LONG.c_str(), GPRMC_LONG.length());
+  REQUIRE(parser.rmc().source == nmea::RmcSource::Unknown);
+
+  parser.encode(GPRMC.c_str(), GPRMC.length());
+  REQUIRE(parser.rmc().time_utc.second == 52);
+}
+
+TEST_CASE("Larger parse buffer accepts messages exceeding 82 characters", "[ParseBufferSize-02]")
+{
+  WHEN("BasicArduinoNmeaParser is used")
+  {
+    BasicArduinoNmeaParser<128> parser(nullptr, nullptr, nullptr);
+
+    for (char const c : GPRMC_LONG)
+      parser.encode(c);
+
+    REQUIRE(parser.rmc().time_utc.second == 52);
+    REQUIRE(parser.rmc().latitude_e7     == 525144667);
+    REQUIRE(parser.rmc().speed           == Approx(39.6122));
+  }
+
+  WHEN("BasicNmeaParser is used")
+  {
+    nmea::BasicNmeaParser<128, nmea::Rmc> parser;
+
+    parser.encode(GPRMC_LONG.c_str(), GPRMC_LONG.length());
+
+    REQUIRE(parser.data<nmea::Rmc>().time_utc.second == 52);
+  }
+}
+
+TEST_CASE("Smaller parse buffer only accepts short messages", "[ParseBufferSize-03]")
+{
+  nmea::BasicNmeaParser<32, nmea::Rmc> parser;
+
+  parser.encode(GPRMC.c_str(), GPRMC.length());
+  REQUIRE(parser.data<nmea::Rmc>().source == nmea::RmcSource::Unknown);
+
+  parser.encode(GPRMC_SHORT.c_str(), GPRMC_SHORT.length());
+  REQUIRE(parser.data<nmea::Rmc>().source == nmea::RmcSource::GPS);
+}
+
+TEST_CASE("Parse buffer size determines the RAM footprint", "[ParseBufferSize-04]")
+{
+  REQUIRE(sizeof(BasicArduinoNmeaParser<nmea::DEFAULT_PARSE_BUFFER_SIZE>) == sizeof(ArduinoNmeaParser));
+  REQUIRE(sizeof(nmea::BasicNmeaParser<32, nmea::Rmc>) < sizeof(nmea::NmeaParser<nmea::Rmc>));
+  REQUIRE(sizeof(BasicArduinoNmeaParser<128>) > sizeof(ArduinoNmeaParser));
+}
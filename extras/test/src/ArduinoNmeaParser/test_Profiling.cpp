@@ -0,0 +1,148 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+static std::string const GNGGA = "$GNGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*64\r\n";
+static std::string const GPGSA = "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n";
+
+static std::string const NMEA_STREAM = GPRMC + GNGGA + GPGSA + GPRMC;
+
+/* Every call advances the fake clock by 3 ticks, each measured
+ * stage therefore takes exactly 3 ticks.
+ */
+static uint32_t fake_clock = 0;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static uint32_t constantTimestamp()
+{
+  return 1000;
+}
+
+static uint32_t fakeTimestamp()
+{
+  fake_clock += 3;
+  return fake_clock;
+}
+
+static void requireStage(nmea::StageProfile const & profile, uint32_t const count)
+{
+  REQUIRE(profile.count        == count);
+  REQUIRE(profile.sum          == 3 * count);
+  REQUIRE(nmea::average(profile) == ((count > 0) ? 3 : 0));
+  REQUIRE(profile.histogram[2] == count);
+}
+
+template <size_t NUM_SENTENCES>
+static void requireProfile(nmea::Profile<NUM_SENTENCES> const & profile, size_t const rmc, size_t const other, uint32_t const other_count)
+{
+  REQUIRE(profile.framing.count > 0);
+  REQUIRE(profile.framing.min   == 3);
+  REQUIRE(profile.framing.max   == 3);
+
+  requireStage(profile.sentence[rmc].field_index, 2);
+  requireStage(profile.sentence[rmc].dispatch,    2);
+  requireStage(profile.sentence[rmc].decode,      2);
+  requireStage(profile.sentence[rmc].callback,    2);
+
+  requireStage(profile.sentence[other].field_index, other_count);
+  requireStage(profile.sentence[other].dispatch,    other_count);
+  requireStage(profile.sentence[other].decode,      0);
+  requireStage(profile.sentence[other].callback,    0);
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Durations are sorted into log2 histogram bins", "[Profiling-01]")
+{
+  nmea::StageProfile profile{};
+
+  nmea::record(profile, 0);
+  nmea::record(profile, 1);
+  nmea::record(profile, 5);
+  nmea::record(profile, 1024);
+  nmea::record(profile, 0xFFFFFFFF);
+
+  REQUIRE(profile.count == 5);
+  REQUIRE(profile.min   == 0);
+  REQUIRE(profile.max   == 0xFFFFFFFF);
+  REQUIRE(profile.sum   == 0x100000405ULL);
+
+  REQUIRE(profile.histogram[0]  == 1);
+  REQUIRE(profile.histogram[1]  == 1);
+  REQUIRE(profile.histogram[3]  == 1);
+  REQUIRE(profile.histogram[11] == 1);
+  REQUIRE(profile.histogram[nmea::NUM_PROFILE_HISTOGRAM_BINS - 1] == 1);
+}
+
+TEST_CASE("ArduinoNmeaParser profiling", "[Profiling-02]")
+{
+  ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+  parser.setTimestampSource(fakeTimestamp);
+
+  WHEN("the stream is encoded character by character")
+  {
+    for (char const c : NMEA_STREAM)
+      parser.encode(c);
+    REQUIRE(parser.profile().framing.count == NMEA_STREAM.length());
+  }
+  WHEN("the stream is encoded at once")
+  {
+    parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+    /* The framer returns after each complete NMEA message. */
+    REQUIRE(parser.profile().framing.count == 4);
+  }
+
+  /* All NMEA messages are decoded. */
+  requireProfile(parser.profile(), 0, 4, 0);
+  requireStage(parser.profile().sentence[1].decode, 1);
+  requireStage(parser.profile().sentence[3].decode, 1);
+}
+
+TEST_CASE("NmeaParser profiling", "[Profiling-03]")
+{
+  nmea::NmeaParser<nmea::Rmc> parser;
+  parser.setTimestampSource(fakeTimestamp);
+
+  parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+
+  /* GNGGA and GPGSA are not decoded. */
+  requireProfile(parser.profile(), 0, 1, 2);
+}
+
+TEST_CASE("Latency from the last character until the callback", "[Profiling-04]")
+{
+  nmea::NmeaParser<nmea::Rmc> parser;
+  parser.setTimestampSource(constantTimestamp);
+
+  parser.encode(GPRMC.c_str(), GPRMC.length(), 400);
+  parser.encode(GPRMC.c_str(), GPRMC.length(), 900);
+
+  nmea::StageProfile const & latency = parser.profile().sentence[0].latency;
+  REQUIRE(latency.count == 2);
+  REQUIRE(latency.min   == 100);
+  REQUIRE(latency.max   == 600);
+  REQUIRE(nmea::average(latency) == 350);
+}
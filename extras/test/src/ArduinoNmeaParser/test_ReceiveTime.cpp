@@ -0,0 +1,75 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+static std::string const GNGGA = "$GNGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*64\r\n";
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Timestamps of the first and the last character are delivered with the data", "[ReceiveTime-01]")
+{
+  ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+
+  REQUIRE(parser.rmc().received.first_byte == nmea::INVALID_RECEIVE_TIME.first_byte);
+  REQUIRE(parser.rmc().received.last_byte  == nmea::INVALID_RECEIVE_TIME.last_byte);
+
+  WHEN("each character is timestamped")
+  {
+    uint32_t timestamp = 1000;
+    for (char const c : GPRMC + GNGGA)
+      parser.encode(c, timestamp++);
+
+    REQUIRE(parser.rmc().received.first_byte == 1000);
+    REQUIRE(parser.rmc().received.last_byte  == 1000 + GPRMC.length() - 1);
+    REQUIRE(parser.gga().received.first_byte == 1000 + GPRMC.length());
+    REQUIRE(parser.gga().received.last_byte  == 1000 + GPRMC.length() + GNGGA.length() - 1);
+  }
+
+  WHEN("chunks are timestamped")
+  {
+    std::string const first_chunk  = GPRMC.substr(0, 40);
+    std::string const second_chunk = GPRMC.substr(40) + GNGGA;
+
+    parser.encode(first_chunk.c_str(), first_chunk.length(), 1000);
+    parser.encode(reinterpret_cast<uint8_t const *>(second_chunk.c_str()), second_chunk.length(), 2000);
+
+    REQUIRE(parser.rmc().received.first_byte == 1000);
+    REQUIRE(parser.rmc().received.last_byte  == 2000);
+    REQUIRE(parser.gga().received.first_byte == 2000);
+    REQUIRE(parser.gga().received.last_byte  == 2000);
+  }
+}
+
+TEST_CASE("NmeaParser delivers the timestamps of the first and the last character", "[ReceiveTime-02]")
+{
+  nmea::NmeaParser<nmea::Rmc> parser;
+
+  std::string const first_chunk  = GPRMC.substr(0, 1);
+  std::string const second_chunk = GPRMC.substr(1);
+
+  parser.encode(first_chunk.c_str(), first_chunk.length(), 7);
+  parser.encode(second_chunk.c_str(), second_chunk.length(), 42);
+
+  REQUIRE(parser.data<nmea::Rmc>().received.first_byte == 7);
+  REQUIRE(parser.data<nmea::Rmc>().received.last_byte  == 42);
+}
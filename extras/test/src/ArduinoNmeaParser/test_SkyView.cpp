@@ -0,0 +1,254 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const GNRMC = "$GNRMC,104100.00,A,5230.88920,N,01320.95800,E,12.000,70.00,171026,,,A,V*02\r\n";
+static std::string const GNGLL = "$GNGLL,5230.88920,N,01320.95800,E,104100.00,A,A*78\r\n";
+
+static std::vector<std::string> const GPGSV =
+{
+  "$GPGSV,3,1,11,02,14,074,,05,35,185,32,07,49,259,48,13,01,121,,1*65\r\n",
+  "$GPGSV,3,2,11,14,08,158,,15,15,195,27,18,36,306,39,20,50,020,,1*6A\r\n",
+  "$GPGSV,3,3,11,23,71,131,26,30,30,030,46,27,09,279,41,1*50\r\n",
+};
+
+static std::vector<std::string> const GLGSV =
+{
+  "$GLGSV,2,1,07,65,05,245,35,66,12,282,45,72,54,144,48,73,61,181,30,1*74\r\n",
+  "$GLGSV,2,2,07,80,20,080,48,81,27,117,38,88,76,016,48,1*4B\r\n",
+};
+
+static std::vector<std::string> const GAGSV =
+{
+  "$GAGSV,3,1,09,03,21,111,43,05,35,185,36,08,56,296,,13,01,121,,7*73\r\n",
+  "$GAGSV,3,2,09,15,15,195,32,24,78,168,,25,85,205,48,31,37,067,28,7*7D\r\n",
+  "$GAGSV,3,3,09,34,58,178,40,7*4A\r\n",
+};
+
+/* A further signal of GPS (L5) following the GPS L1 sequence. */
+static std::string const GPGSV_L5 = "$GPGSV,1,1,02,05,35,185,40,07,49,259,45,8*61\r\n";
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+typedef struct
+{
+  std::vector<nmea::SkyView> sky_views;
+  uint32_t timestamp;
+} SkyViews;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static void onSkyView(nmea::SkyView const & sky_view, void * context)
+{
+  static_cast<SkyViews *>(context)->sky_views.push_back(sky_view);
+}
+
+static void encode(ArduinoNmeaParser & parser, SkyViews & sky_views, std::string const & nmea)
+{
+  for (char const c : nmea)
+    parser.encode(c, sky_views.timestamp++);
+}
+
+static void encode(ArduinoNmeaParser & parser, SkyViews & sky_views, std::vector<std::string> const & sequence)
+{
+  for (std::string const & nmea : sequence)
+    encode(parser, sky_views, nmea);
+}
+
+static nmea::ConstellationView const & constellation(nmea::SkyView const & sky_view, nmea::Constellation const c)
+{
+  return sky_view.constellation[static_cast<size_t>(c)];
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("All GSV messages of an epoch are assembled into a single sky view", "[SkyView-01]")
+{
+  SkyViews sky_views{{}, 0};
+  nmea::SkyViewAssembler assembler(onSkyView, &sky_views);
+  ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+  parser.setSkyView(&assembler);
+
+  encode(parser, sky_views, GNRMC);
+  encode(parser, sky_views, GPGSV);
+  encode(parser, sky_views, GLGSV);
+  encode(parser, sky_views, GAGSV);
+  uint32_t const last_gsv_byte = sky_views.timestamp - 1;
+
+  /* The end of the epoch is only known with the next NMEA message. */
+  REQUIRE(sky_views.sky_views.empty());
+  encode(parser, sky_views, GNGLL);
+  REQUIRE(sky_views.sky_views.size() == 1);
+
+  nmea::SkyView const & sky_view = sky_views.sky_views[0];
+  REQUIRE(sky_view.received.first_byte == GNRMC.length());
+  REQUIRE(sky_view.received.last_byte  == last_gsv_byte);
+
+  nmea::ConstellationView const & gps = constellation(sky_view, nmea::Constellation::GPS);
+  REQUIRE(gps.is_valid);
+  REQUIRE(gps.num_satellites == 11);
+  REQUIRE(gps.num_entries    == 11);
+  REQUIRE(gps.signal_id      == 1);
+  REQUIRE(gps.satellite[0].id   == 2);
+  REQUIRE(gps.satellite[0].snr  == -1);
+  REQUIRE(gps.satellite[10].id        == 27);
+  REQUIRE(gps.satellite[10].elevation == 9);
+  REQUIRE(gps.satellite[10].azimuth   == 279);
+  REQUIRE(gps.satellite[10].snr       == 41);
+
+  REQUIRE(constellation(sky_view, nmea::Constellation::GLONASS).num_entries == 7);
+  REQUIRE(constellation(sky_view, nmea::Constellation::Galileo).num_entries == 9);
+  REQUIRE(constellation(sky_view, nmea::Constellation::Galileo).signal_id   == 7);
+  REQUIRE_FALSE(constellation(sky_view, nmea::Constellation::BDS).is_valid);
+  REQUIRE_FALSE(constellation(sky_view, nmea::Constellation::QZSS).is_valid);
+
+  REQUIRE(parser.decodedMessages<nmea::Gsv>() == 8);
+  REQUIRE(assembler.sequenceGaps() == 0);
+}
+
+TEST_CASE("A missing GSV message drops the sequence of its constellation", "[SkyView-02]")
+{
+  SkyViews sky_views{{}, 0};
+  nmea::SkyViewAssembler assembler(onSkyView, &sky_views);
+  ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+  parser.setSkyView(&assembler);
+
+  WHEN("the first GSV message is missing")
+  {
+    encode(parser, sky_views, GPGSV);
+    encode(parser, sky_views, GLGSV[1]);
+    encode(parser, sky_views, GAGSV);
+  }
+  WHEN("the last GSV message is missing")
+  {
+    encode(parser, sky_views, GPGSV);
+    encode(parser, sky_views, GLGSV[0]);
+    encode(parser, sky_views, GAGSV);
+  }
+  WHEN("a GSV message is corrupted")
+  {
+    std::string corrupted = GLGSV[0];
+    corrupted[20] = '9';
+    encode(parser, sky_views, GPGSV);
+    encode(parser, sky_views, std::vector<std::string>{corrupted, GLGSV[1]});
+    encode(parser, sky_views, GAGSV);
+  }
+  encode(parser, sky_views, GNGLL);
+
+  REQUIRE(sky_views.sky_views.size() == 1);
+  REQUIRE(assembler.sequenceGaps() == 1);
+
+  nmea::SkyView const & sky_view = sky_views.sky_views[0];
+  REQUIRE(constellation(sky_view, nmea::Constellation::GPS).is_valid);
+  REQUIRE(constellation(sky_view, nmea::Constellation::Galileo).is_valid);
+  REQUIRE_FALSE(constellation(sky_view, nmea::Constellation::GLONASS).is_valid);
+  REQUIRE(constellation(sky_view, nmea::Constellation::GLONASS).num_entries == 0);
+}
+
+TEST_CASE("A repeated constellation starts the next epoch", "[SkyView-03]")
+{
+  SkyViews sky_views{{}, 0};
+  nmea::SkyViewAssembler assembler(onSkyView, &sky_views);
+  ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+  parser.setSkyView(&assembler);
+
+  /* Further signals of a constellation do not end the epoch. */
+  encode(parser, sky_views, GPGSV);
+  encode(parser, sky_views, GPGSV_L5);
+  encode(parser, sky_views, GLGSV);
+  REQUIRE(sky_views.sky_views.empty());
+
+  encode(parser, sky_views, GPGSV);
+  REQUIRE(sky_views.sky_views.size() == 1);
+  REQUIRE(constellation(sky_views.sky_views[0], nmea::Constellation::GPS).num_entries == 11);
+  REQUIRE(constellation(sky_views.sky_views[0], nmea::Constellation::GPS).signal_id   == 1);
+  REQUIRE(constellation(sky_views.sky_views[0], nmea::Constellation::GLONASS).is_valid);
+
+  assembler.flush();
+  REQUIRE(sky_views.sky_views.size() == 2);
+  REQUIRE(constellation(sky_views.sky_views[1], nmea::Constellation::GPS).is_valid);
+  REQUIRE_FALSE(constellation(sky_views.sky_views[1], nmea::Constellation::GLONASS).is_valid);
+  REQUIRE(assembler.sequenceGaps() == 0);
+}
+
+TEST_CASE("Streaming decode yields the same sky view", "[SkyView-04]")
+{
+  SkyViews expected{{}, 0};
+  nmea::SkyViewAssembler expected_assembler(onSkyView, &expected);
+  ArduinoNmeaParser whole_parser(nullptr, nullptr, nullptr);
+  whole_parser.setSkyView(&expected_assembler);
+
+  SkyViews actual{{}, 0};
+  nmea::SkyViewAssembler actual_assembler(onSkyView, &actual);
+  ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+  parser.setSkyView(&actual_assembler);
+  parser.setStreamingDecode(true);
+
+  for (ArduinoNmeaParser * p : {&whole_parser, &parser})
+  {
+    SkyViews & sky_views = (p == &parser) ? actual : expected;
+    encode(*p, sky_views, GPGSV);
+    encode(*p, sky_views, GAGSV);
+    encode(*p, sky_views, GNRMC);
+  }
+
+  REQUIRE(actual.sky_views.size() == 1);
+  REQUIRE(expected.sky_views.size() == 1);
+  for (size_t c = 0; c < nmea::NUM_CONSTELLATIONS; c++)
+  {
+    nmea::ConstellationView const & a = actual.sky_views[0].constellation[c];
+    nmea::ConstellationView const & e = expected.sky_views[0].constellation[c];
+    REQUIRE(a.is_valid    == e.is_valid);
+    REQUIRE(a.num_entries == e.num_entries);
+    for (size_t s = 0; s < e.num_entries; s++)
+    {
+      REQUIRE(a.satellite[s].id        == e.satellite[s].id);
+      REQUIRE(a.satellite[s].elevation == e.satellite[s].elevation);
+      REQUIRE(a.satellite[s].azimuth   == e.satellite[s].azimuth);
+      REQUIRE(a.satellite[s].snr       == e.satellite[s].snr);
+    }
+  }
+  REQUIRE(parser.decodedMessages<nmea::Gsv>() == 6);
+}
+
+TEST_CASE("GSV messages are not decoded without a sky view assembler", "[SkyView-05]")
+{
+  SkyViews sky_views{{}, 0};
+  nmea::SkyViewAssembler assembler(onSkyView, &sky_views);
+  ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+
+  encode(parser, sky_views, GPGSV);
+  parser.setSkyView(&assembler);
+  encode(parser, sky_views, GNGLL);
+  encode(parser, sky_views, GLGSV);
+  parser.setSkyView(nullptr);
+  encode(parser, sky_views, GNGLL);
+
+  REQUIRE(sky_views.sky_views.empty());
+  REQUIRE(parser.decodedMessages<nmea::Gsv>() == 5);
+  REQUIRE(parser.statistics().unknown_messages == 2);
+}
@@ -0,0 +1,102 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const NOISE        = "noise\r\n";
+static std::string const GPRMC        = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+static std::string const GNGGA        = "$GNGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*64\r\n";
+static std::string const GPGSA        = "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n";
+static std::string const GPRMC_CRC    = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*78\r\n";
+static std::string const GPRMC_LONG   = "$GPRMC,052859.105,A,5230.874,N,01321.056,E,085.7,206.4,080720,000000000000.0,W*7E\r\n";
+static std::string const PUBX         = "$PUBX,41,1,0007,0003,19200,0*25\r\n";
+
+static std::string const NMEA_STREAM = NOISE + GPRMC + GNGGA + GPGSA + GPRMC_CRC + GPRMC_LONG + PUBX;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+template <typename Parser>
+static void requireStatistics(Parser const & parser, uint32_t const unknown_messages)
+{
+  nmea::Statistics const statistics = parser.statistics();
+
+  REQUIRE(GPRMC_LONG.length() == 83);
+
+  REQUIRE(statistics.received_bytes   == NMEA_STREAM.length());
+  REQUIRE(statistics.discarded_bytes  == NOISE.length() + GPRMC_LONG.length());
+  REQUIRE(statistics.framed_messages  == 5);
+  REQUIRE(statistics.checksum_errors  == 1);
+  REQUIRE(statistics.overflows        == 1);
+  REQUIRE(statistics.unknown_messages == unknown_messages);
+
+  REQUIRE(statistics.talker_messages[static_cast<size_t>(nmea::RmcSource::Unknown)] == 0);
+  REQUIRE(statistics.talker_messages[static_cast<size_t>(nmea::RmcSource::GPS)]     == 2);
+  REQUIRE(statistics.talker_messages[static_cast<size_t>(nmea::RmcSource::GNSS)]    == 1);
+  REQUIRE(statistics.talker_messages[static_cast<size_t>(nmea::RmcSource::GLONASS)] == 0);
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("ArduinoNmeaParser statistics", "[Statistics-01]")
+{
+  ArduinoNmeaParser parser(nullptr, nullptr, nullptr);
+
+  nmea::Statistics const initial = parser.statistics();
+  REQUIRE(initial.received_bytes  == 0);
+  REQUIRE(initial.framed_messages == 0);
+
+  WHEN("the stream is encoded character by character")
+  {
+    for (char const c : NMEA_STREAM)
+      parser.encode(c);
+  }
+  WHEN("the stream is encoded at once")
+  {
+    parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+  }
+
+  /* PUBX is not decoded. */
+  requireStatistics(parser, 1);
+  REQUIRE(parser.decodedMessages<nmea::Rmc>() == 1);
+  REQUIRE(parser.decodedMessages<nmea::Gga>() == 1);
+  REQUIRE(parser.decodedMessages<nmea::Gsa>() == 1);
+}
+
+TEST_CASE("NmeaParser statistics", "[Statistics-02]")
+{
+  nmea::NmeaParser<nmea::Rmc> parser;
+
+  WHEN("the stream is encoded character by character")
+  {
+    for (char const c : NMEA_STREAM)
+      parser.encode(c);
+  }
+  WHEN("the stream is encoded at once")
+  {
+    parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+  }
+
+  /* GNGGA, GPGSA and PUBX are not decoded. */
+  requireStatistics(parser, 3);
+  REQUIRE(parser.decodedMessages<nmea::Rmc>() == 1);
+}
@@ -0,0 +1,328 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <math.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+/* Covers empty fields, all hemispheres, missing trailing fields,
+ * checksum errors, truncated messages and unsupported messages.
+ */
+static std::string const NMEA_STREAM =
+  std::string("noise\r\n") +
+  "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n" +
+  "$GNRMC,104100.00,A,5230.88920,N,01320.95800,E,12.000,70.00,171026,,,A,V*02\r\n" +
+  "$GPRMC,,V,,,,,,,,,,N*53\r\n" +
+  "$GPRMC,142600.00,A,4837.99474,S,01301.53452,W,27.920,247.03,121020,,,A*55\r\n" +
+  "$GNGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*64\r\n" +
+  "$GNGGA,104100.00,5230.88920,N,01320.95800,E,1,17,0.97,34.5,M,44.9,M,,*7E\r\n" +
+  "$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n" +
+  "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n" +
+  "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*78\r\n" + /* Checksum mismatch. */
+  "$GPRMC,052853.105,A,5230.8" + /* Truncated message. */
+  "$GPGGA,111909.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7B\r\n" +
+  "$GPRMC,052854*";
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+typedef struct
+{
+  std::vector<nmea::RmcData> rmc;
+  std::vector<nmea::GgaData> gga;
+  /* Provisional deliveries and verdicts of the early dispatch. */
+  std::vector<std::string> events;
+  std::vector<nmea::RmcData> provisional_rmc;
+} Streamed;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static void onRmcUpdate(nmea::RmcData const & rmc, void * context) { static_cast<Streamed *>(context)->rmc.push_back(rmc); }
+static void onGgaUpdate(nmea::GgaData const & gga, void * context) { static_cast<Streamed *>(context)->gga.push_back(gga); }
+
+static void onRmcProvisional(nmea::RmcData const & rmc, nmea::Provisional const available, void * context)
+{
+  Streamed * result = static_cast<Streamed *>(context);
+  result->events.push_back((available == nmea::Provisional::Time) ? "rmc-time" : "rmc-position");
+  result->provisional_rmc.push_back(rmc);
+}
+
+static void onGgaProvisional(nmea::GgaData const &, nmea::Provisional const available, void * context)
+{
+  static_cast<Streamed *>(context)->events.push_back((available == nmea::Provisional::Time) ? "gga-time" : "gga-position");
+}
+
+static void onVerdict(nmea::Verdict const verdict, void * context)
+{
+  static_cast<Streamed *>(context)->events.push_back((verdict == nmea::Verdict::Confirmed) ? "confirmed" : "retracted");
+}
+
+static bool isSame(float const a, float const b)
+{
+  return (isnan(a) && isnan(b)) || (a == b);
+}
+
+static void requireSame(nmea::Time const & a, nmea::Time const & b)
+{
+  REQUIRE(a.hour        == b.hour);
+  REQUIRE(a.minute      == b.minute);
+  REQUIRE(a.second      == b.second);
+  REQUIRE(a.microsecond == b.microsecond);
+}
+
+static void requireSame(nmea::RmcData const & a, nmea::RmcData const & b)
+{
+  REQUIRE(a.source == b.source);
+  requireSame(a.time_utc, b.time_utc);
+  REQUIRE(a.is_valid == b.is_valid);
+  REQUIRE(isSame(a.latitude, b.latitude));
+  REQUIRE(isSame(a.longitude, b.longitude));
+  REQUIRE(a.latitude_e7  == b.latitude_e7);
+  REQUIRE(a.longitude_e7 == b.longitude_e7);
+  REQUIRE(isSame(a.speed, b.speed));
+  REQUIRE(isSame(a.course, b.course));
+  REQUIRE(isSame(a.magnetic_variation, b.magnetic_variation));
+  REQUIRE(a.date.day   == b.date.day);
+  REQUIRE(a.date.month == b.date.month);
+  REQUIRE(a.date.year  == b.date.year);
+  REQUIRE(a.received.first_byte == b.received.first_byte);
+  REQUIRE(a.received.last_byte  == b.received.last_byte);
+}
+
+static void requireSame(nmea::GgaData const & a, nmea::GgaData const & b)
+{
+  REQUIRE(a.source == b.source);
+  requireSame(a.time_utc, b.time_utc);
+  REQUIRE(isSame(a.latitude, b.latitude));
+  REQUIRE(isSame(a.longitude, b.longitude));
+  REQUIRE(a.latitude_e7  == b.latitude_e7);
+  REQUIRE(a.longitude_e7 == b.longitude_e7);
+  REQUIRE(a.fix_quality == b.fix_quality);
+  REQUIRE(a.num_satellites == b.num_satellites);
+  REQUIRE(isSame(a.hdop, b.hdop));
+  REQUIRE(isSame(a.altitude, b.altitude));
+  REQUIRE(isSame(a.geoidal_separation, b.geoidal_separation));
+  REQUIRE(a.dgps_age == b.dgps_age);
+  REQUIRE(std::equal(a.dgps_id, a.dgps_id + sizeof(a.dgps_id), b.dgps_id));
+  REQUIRE(a.received.first_byte == b.received.first_byte);
+  REQUIRE(a.received.last_byte  == b.received.last_byte);
+}
+
+static void requireSame(Streamed const & a, Streamed const & b)
+{
+  REQUIRE(a.rmc.size() == b.rmc.size());
+  REQUIRE(a.gga.size() == b.gga.size());
+  for (size_t i = 0; i < a.rmc.size(); i++)
+    requireSame(a.rmc[i], b.rmc[i]);
+  for (size_t i = 0; i < a.gga.size(); i++)
+    requireSame(a.gga[i], b.gga[i]);
+}
+
+static void requireSame(nmea::Statistics const & a, nmea::Statistics const & b)
+{
+  REQUIRE(a.received_bytes   == b.received_bytes);
+  REQUIRE(a.discarded_bytes  == b.discarded_bytes);
+  REQUIRE(a.framed_messages  == b.framed_messages);
+  REQUIRE(a.checksum_errors  == b.checksum_errors);
+  REQUIRE(a.overflows        == b.overflows);
+  REQUIRE(a.unknown_messages == b.unknown_messages);
+  REQUIRE(std::equal(a.talker_messages, a.talker_messages + nmea::NUM_TALKERS, b.talker_messages));
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Streaming decode yields the same data as decoding whole NMEA messages", "[StreamingDecode-01]")
+{
+  Streamed expected;
+  ArduinoNmeaParser whole_parser(onRmcUpdate, onGgaUpdate, &expected);
+  uint32_t timestamp = 0;
+  for (char const c : NMEA_STREAM)
+    whole_parser.encode(c, timestamp++);
+
+  REQUIRE(expected.rmc.size() == 4);
+  REQUIRE(expected.gga.size() == 4);
+
+  WHEN("encoding character by character")
+  {
+    Streamed actual;
+    ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &actual);
+    parser.setStreamingDecode(true);
+    timestamp = 0;
+    for (char const c : NMEA_STREAM)
+      parser.encode(c, timestamp++);
+
+    requireSame(actual, expected);
+    requireSame(parser.statistics(), whole_parser.statistics());
+    REQUIRE(parser.decodedMessages<nmea::Rmc>() == 4);
+    REQUIRE(parser.decodedMessages<nmea::Gga>() == 4);
+    REQUIRE(parser.error() == ArduinoNmeaParser::Error::Checksum);
+  }
+
+  WHEN("encoding chunks")
+  {
+    Streamed actual;
+    ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &actual);
+    parser.setStreamingDecode(true);
+    for (size_t offset = 0; offset < NMEA_STREAM.length(); offset += 13)
+      parser.encode(NMEA_STREAM.c_str() + offset, std::min<size_t>(13, NMEA_STREAM.length() - offset));
+
+    REQUIRE(actual.rmc.size() == expected.rmc.size());
+    REQUIRE(actual.gga.size() == expected.gga.size());
+    REQUIRE(actual.rmc.back().latitude_e7 == expected.rmc.back().latitude_e7);
+    REQUIRE(actual.gga.back().latitude_e7 == expected.gga.back().latitude_e7);
+    requireSame(parser.statistics(), whole_parser.statistics());
+  }
+
+  WHEN("combined with the early dispatch")
+  {
+    Streamed reference;
+    ArduinoNmeaParser reference_parser(onRmcUpdate, onGgaUpdate, &reference);
+    reference_parser.setEarlyDispatch(onRmcProvisional, onGgaProvisional, onVerdict);
+
+    Streamed actual;
+    ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &actual);
+    parser.setStreamingDecode(true);
+    parser.setEarlyDispatch(onRmcProvisional, onGgaProvisional, onVerdict);
+
+    timestamp = 0;
+    for (char const c : NMEA_STREAM)
+    {
+      reference_parser.encode(c, timestamp);
+      parser.encode(c, timestamp++);
+    }
+
+    requireSame(actual, expected);
+    REQUIRE(actual.events == reference.events);
+    REQUIRE(std::count(actual.events.begin(), actual.events.end(), "confirmed") == 8);
+    /* The checksum mismatch and the truncated message, the final
+     * NMEA message is still awaiting its verdict.
+     */
+    REQUIRE(std::count(actual.events.begin(), actual.events.end(), "retracted") == 2);
+  }
+}
+
+TEST_CASE("Toggling the streaming decode while receiving a NMEA message", "[StreamingDecode-02]")
+{
+  std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+
+  Streamed result;
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &result);
+
+  parser.encode(GPRMC.c_str(), 20);
+  parser.setStreamingDecode(true);
+  parser.encode(GPRMC.c_str() + 20, GPRMC.length() - 20);
+  parser.encode(GPRMC.c_str(), 20);
+  parser.setStreamingDecode(false);
+  parser.encode(GPRMC.c_str() + 20, GPRMC.length() - 20);
+
+  REQUIRE(result.rmc.size() == 2);
+  requireSame(result.rmc[0], result.rmc[1]);
+  REQUIRE(result.rmc[1].latitude_e7 == 525144667);
+  REQUIRE(result.rmc[1].magnetic_variation == 0.0f);
+}
+
+TEST_CASE("Streaming decode delivers provisional fields before the verdict", "[StreamingDecode-03]")
+{
+  std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+  std::string const GNGGA = "$GNGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*64\r\n";
+
+  Streamed result;
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &result);
+  parser.setStreamingDecode(true);
+  parser.setEarlyDispatch(onRmcProvisional, onGgaProvisional, onVerdict);
+
+  WHEN("the checksum matches")
+  {
+    parser.encode((GPRMC + GNGGA).c_str(), GPRMC.length() + GNGGA.length());
+
+    REQUIRE(result.events == std::vector<std::string>{"rmc-time", "rmc-position", "confirmed",
+                                                      "gga-time", "gga-position", "confirmed"});
+    REQUIRE(result.rmc.size() == 1);
+    REQUIRE(result.gga.size() == 1);
+    REQUIRE(result.provisional_rmc[1].latitude_e7  == result.rmc[0].latitude_e7);
+    REQUIRE(result.provisional_rmc[1].longitude_e7 == result.rmc[0].longitude_e7);
+    REQUIRE(parser.decodedMessages<nmea::Rmc>() == 1);
+  }
+
+  WHEN("the checksum does not match")
+  {
+    std::string const corrupted = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*78\r\n";
+    for (char const c : corrupted + GPRMC)
+      parser.encode(c);
+
+    REQUIRE(result.events == std::vector<std::string>{"rmc-time", "rmc-position", "retracted",
+                                                      "rmc-time", "rmc-position", "confirmed"});
+    REQUIRE(result.rmc.size() == 1);
+    REQUIRE(parser.error() == ArduinoNmeaParser::Error::Checksum);
+    REQUIRE(parser.statistics().checksum_errors == 1);
+    REQUIRE(parser.decodedMessages<nmea::Rmc>() == 1);
+  }
+}
+
+TEST_CASE("Streaming decode completes at most one field per encode(char) call", "[StreamingDecode-04]")
+{
+  /* The framer reports a field with the ',' or '*' terminating it,
+   * hence every call hands at most one field over to the decoder.
+   */
+  nmea::NmeaFramer<nmea::DEFAULT_PARSE_BUFFER_SIZE> framer;
+  framer.reportFields(true);
+
+  size_t num_fields = 0;
+  for (char const c : NMEA_STREAM)
+  {
+    if (framer.encode(c) != nmea::FramerEvent::Field)
+      continue;
+    REQUIRE((c == ',' || c == '*'));
+    num_fields++;
+  }
+  REQUIRE(num_fields == static_cast<size_t>(std::count(NMEA_STREAM.begin(), NMEA_STREAM.end(), ',') + std::count(NMEA_STREAM.begin(), NMEA_STREAM.end(), '*')));
+
+  /* The call receiving the '\n' only takes over the result, the
+   * message is neither indexed nor dispatched nor decoded as a whole.
+   */
+  Streamed result;
+  ArduinoNmeaParser parser(onRmcUpdate, onGgaUpdate, &result);
+  parser.setStreamingDecode(true);
+  for (char const c : NMEA_STREAM)
+    parser.encode(c);
+
+  REQUIRE(result.rmc.size() == 4);
+  for (size_t entry = 0; entry < 2; entry++)
+  {
+    nmea::SentenceProfile const & profile = parser.profile().sentence[entry];
+    REQUIRE(profile.decode.count      == 4);
+    REQUIRE(profile.field_index.count == 0);
+    REQUIRE(profile.dispatch.count    == 0);
+  }
+
+  WHEN("decoding whole NMEA messages")
+  {
+    ArduinoNmeaParser whole_parser(onRmcUpdate, onGgaUpdate, &result);
+    for (char const c : NMEA_STREAM)
+      whole_parser.encode(c);
+    REQUIRE(whole_parser.profile().sentence[0].field_index.count == 4);
+  }
+}
@@ -44,6 +44,8 @@ TEST_CASE("No NMEA message received", "[Parser-01]")
   REQUIRE(parser.rmc().source                         == nmea::RmcSource::Unknown);
   REQUIRE(std::isnan(parser.rmc().latitude)           == true);
   REQUIRE(std::isnan(parser.rmc().longitude)          == true);
+  REQUIRE(parser.rmc().latitude_e7                    == nmea::INVALID_COORDINATE_E7);
+  REQUIRE(parser.rmc().longitude_e7                   == nmea::INVALID_COORDINATE_E7);
   REQUIRE(parser.rmc().time_utc.hour                  == -1);
   REQUIRE(parser.rmc().time_utc.minute                == -1);
   REQUIRE(parser.rmc().time_utc.second                == -1);
@@ -247,3 +249,49 @@ TEST_CASE("NMEA message with no checksum received", "[Parser-07]")
   std::string const GPRMC = "79\r\n"; /* This should not lead to a segmentation violation. */
   encode(parser, GPRMC);
 }
+
+TEST_CASE("NMEA message with lower case checksum digits received", "[Parser-08]")
+{
+  ArduinoNmeaParser parser(nullptr, nullptr);
+
+  std::string const GPRMC = "$GPRMC,142600.00,A,4837.99474,N,01301.53452,E,27.920,247.03,121020,,,A*5a\r\n";
+
+  encode(parser, GPRMC);
+
+  REQUIRE(parser.error()          == ArduinoNmeaParser::Error::None);
+  REQUIRE(parser.rmc().date.day   == 12);
+  REQUIRE(parser.rmc().date.month == 10);
+  REQUIRE(parser.rmc().date.year  == 2020);
+}
+
+TEST_CASE("Converting the received date/time into a POSIX timestamp", "[Parser-09]")
+{
+  ArduinoNmeaParser parser(nullptr, nullptr);
+
+  encode(parser, "$GPRMC,142600.00,A,4837.99474,N,01301.53452,E,27.920,247.03,121020,,,A*5A\r\n");
+
+  time_t const posix_timestamp = parser.toPosixTimestamp(parser.rmc().date, parser.rmc().time_utc);
+
+  REQUIRE(posix_timestamp == 1602512760);
+  REQUIRE(posix_timestamp == nmea::toPosixTimestamp(parser.rmc().date, parser.rmc().time_utc));
+}
+
+TEST_CASE("GNGSA messages of all constellations update the latest GSA data", "[Parser-10]")
+{
+  size_t num_updates = 0;
+  ArduinoNmeaParser parser(nullptr, nullptr, &num_updates);
+  parser.setOnGsaUpdate([](nmea::GsaData const &, void * context) { (*static_cast<size_t *>(context))++; });
+
+  REQUIRE(parser.gsa().fix_type == nmea::FixType::Invalid);
+
+  encode(parser, "$GNGSA,A,3,02,05,07,14,15,18,20,23,30,,,,1.60,0.90,1.30,1*05\r\n"
+                 "$GNGSA,A,3,72,80,81,,,,,,,,,,1.60,0.90,1.30,2*0A\r\n"
+                 "$GNGSA,A,3,03,05,08,15,24,25,,,,,,,1.60,0.90,1.30,3*04\r\n"
+                 "$GNGSA,A,3,06,09,14,20,22,,,,,,,,1.60,0.90,1.30,4*00\r\n");
+
+  REQUIRE(num_updates == 4);
+  REQUIRE(parser.gsa().fix_type == nmea::FixType::Fix3D);
+  REQUIRE(parser.gsa().hdop     == Approx(0.9f));
+  REQUIRE(nmea::numActive(parser.gsa()) == 23);
+  REQUIRE(nmea::isActive(parser.gsa(), nmea::Constellation::GLONASS, 80));
+}
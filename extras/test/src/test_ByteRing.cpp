@@ -0,0 +1,129 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+#include <vector>
+#include <thread>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+#include <nmea/ByteRing.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* Records all characters handed over by ByteRing::feed. */
+class Sink
+{
+public:
+  std::string received;
+  size_t num_calls = 0;
+
+  void encode(uint8_t const * buf, size_t const len)
+  {
+    received.append(reinterpret_cast<char const *>(buf), len);
+    num_calls++;
+  }
+};
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Characters are fed in the order they were pushed", "[ByteRing-01]")
+{
+  nmea::ByteRing<8> ring;
+  Sink sink;
+
+  REQUIRE(ring.capacity() == 8);
+  REQUIRE(ring.size() == 0);
+  REQUIRE(ring.feed(sink) == 0);
+  REQUIRE(sink.num_calls == 0);
+
+  REQUIRE(ring.push('a'));
+  REQUIRE(ring.push(reinterpret_cast<uint8_t const *>("bcd"), 3) == 3);
+  REQUIRE(ring.size() == 4);
+
+  REQUIRE(ring.feed(sink) == 4);
+  REQUIRE(sink.received == "abcd");
+  REQUIRE(sink.num_calls == 1);
+  REQUIRE(ring.size() == 0);
+}
+
+TEST_CASE("Wrapping around the end of the ring", "[ByteRing-02]")
+{
+  nmea::ByteRing<8> ring;
+  Sink sink;
+
+  ring.push(reinterpret_cast<uint8_t const *>("012345"), 6);
+  ring.feed(sink);
+  sink.received.clear();
+  sink.num_calls = 0;
+
+  REQUIRE(ring.push(reinterpret_cast<uint8_t const *>("6789ABCD"), 8) == 8);
+  REQUIRE(ring.size() == 8);
+
+  REQUIRE(ring.feed(sink) == 8);
+  REQUIRE(sink.received == "6789ABCD");
+  REQUIRE(sink.num_calls == 2);
+  REQUIRE(ring.overruns() == 0);
+}
+
+TEST_CASE("Characters exceeding the capacity are counted as overruns", "[ByteRing-03]")
+{
+  nmea::ByteRing<4> ring;
+  Sink sink;
+
+  REQUIRE(ring.push(reinterpret_cast<uint8_t const *>("abc"), 3) == 3);
+  REQUIRE(ring.push('d'));
+  REQUIRE_FALSE(ring.push('e'));
+  REQUIRE(ring.push(reinterpret_cast<uint8_t const *>("fg"), 2) == 0);
+  REQUIRE(ring.overruns() == 3);
+
+  ring.feed(sink);
+  REQUIRE(sink.received == "abcd");
+  REQUIRE(ring.push(reinterpret_cast<uint8_t const *>("hijkl"), 5) == 4);
+  REQUIRE(ring.overruns() == 4);
+}
+
+TEST_CASE("Feeding a parser from another thread", "[ByteRing-04]")
+{
+  static size_t const NUM_MESSAGES = 2000;
+
+  nmea::ByteRing<64> ring;
+  size_t num_rmc = 0;
+  ArduinoNmeaParser parser([](nmea::RmcData const & /* rmc */, void * context) { (*static_cast<size_t *>(context))++; }, nullptr, &num_rmc);
+
+  std::thread producer([&ring]()
+  {
+    for (size_t m = 0; m < NUM_MESSAGES; m++)
+      for (char const c : GPRMC)
+        while (!ring.push(static_cast<uint8_t>(c)))
+          std::this_thread::yield();
+  });
+
+  size_t num_fed = 0;
+  while (num_fed < NUM_MESSAGES * GPRMC.length())
+    num_fed += ring.feed(parser);
+
+  producer.join();
+
+  REQUIRE(num_rmc == NUM_MESSAGES);
+  REQUIRE(parser.rmc().time_utc.second == 52);
+}
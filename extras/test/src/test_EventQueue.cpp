@@ -0,0 +1,229 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+#include <thread>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+#include <nmea/EventQueue.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+static std::string const GNGGA = "$GNGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*64\r\n";
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static nmea::RmcData makeRmc(int const second)
+{
+  nmea::RmcData rmc = nmea::INVALID_RMC;
+  rmc.time_utc.second = second;
+  return rmc;
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Events are delivered in order", "[EventQueue-01]")
+{
+  nmea::EventQueue<4> queue;
+  nmea::Event event;
+
+  REQUIRE(queue.capacity() == 4);
+  REQUIRE_FALSE(queue.pop(event));
+
+  nmea::GgaData gga = nmea::INVALID_GGA;
+  gga.num_satellites = 5;
+
+  REQUIRE(queue.push(makeRmc(1)));
+  REQUIRE(queue.push(gga));
+  REQUIRE(queue.size() == 2);
+
+  REQUIRE(queue.pop(event));
+  REQUIRE(event.type == nmea::EventType::Rmc);
+  REQUIRE(event.rmc.time_utc.second == 1);
+
+  REQUIRE(queue.pop(event));
+  REQUIRE(event.type == nmea::EventType::Gga);
+  REQUIRE(event.gga.num_satellites == 5);
+
+  REQUIRE_FALSE(queue.pop(event));
+  REQUIRE(queue.overflows() == 0);
+}
+
+TEST_CASE("A full queue drops the oldest event", "[EventQueue-02]")
+{
+  nmea::EventQueue<4, nmea::OverflowPolicy::DropOldest> queue;
+  nmea::Event event;
+
+  for (int s = 0; s < 10; s++)
+    REQUIRE(queue.push(makeRmc(s)));
+
+  REQUIRE(queue.size() == 4);
+  REQUIRE(queue.overflows() == 6);
+
+  for (int s = 6; s < 10; s++)
+  {
+    REQUIRE(queue.pop(event));
+    REQUIRE(event.rmc.time_utc.second == s);
+  }
+  REQUIRE_FALSE(queue.pop(event));
+}
+
+TEST_CASE("A full queue drops the newest event", "[EventQueue-03]")
+{
+  nmea::EventQueue<4, nmea::OverflowPolicy::DropNewest> queue;
+  nmea::Event event;
+
+  for (int s = 0; s < 10; s++)
+    REQUIRE(queue.push(makeRmc(s)) == (s < 4));
+
+  REQUIRE(queue.overflows() == 6);
+
+  for (int s = 0; s < 4; s++)
+  {
+    REQUIRE(queue.pop(event));
+    REQUIRE(event.rmc.time_utc.second == s);
+  }
+  REQUIRE_FALSE(queue.pop(event));
+
+  REQUIRE(queue.push(makeRmc(42)));
+  REQUIRE(queue.pop(event));
+  REQUIRE(event.rmc.time_utc.second == 42);
+}
+
+TEST_CASE("The default policy depends on compare-and-swap support", "[EventQueue-07]")
+{
+  nmea::EventQueue<4> queue;
+  nmea::Event event;
+
+  for (int s = 0; s < 5; s++)
+    queue.push(makeRmc(s));
+
+  REQUIRE(queue.overflows() == 1);
+  REQUIRE(queue.pop(event));
+#if NMEA_EVENT_QUEUE_HAS_CAS
+  REQUIRE(nmea::DEFAULT_OVERFLOW_POLICY == nmea::OverflowPolicy::DropOldest);
+  REQUIRE(event.rmc.time_utc.second == 1);
+#else
+  REQUIRE(nmea::DEFAULT_OVERFLOW_POLICY == nmea::OverflowPolicy::DropNewest);
+  REQUIRE(event.rmc.time_utc.second == 0);
+#endif
+}
+
+TEST_CASE("Parsers fill the queue via their update callbacks", "[EventQueue-04]")
+{
+  typedef nmea::EventQueue<8> Queue;
+  Queue queue;
+  nmea::Event event;
+
+  WHEN("ArduinoNmeaParser is used")
+  {
+    ArduinoNmeaParser parser(Queue::onUpdate<nmea::RmcData>, Queue::onUpdate<nmea::GgaData>, &queue);
+    parser.encode((GPRMC + GNGGA).c_str(), GPRMC.length() + GNGGA.length());
+  }
+  WHEN("NmeaParser is used")
+  {
+    nmea::NmeaParser<nmea::Rmc, nmea::Gga> parser(&queue);
+    parser.onUpdate<nmea::Rmc>(Queue::onUpdate<nmea::RmcData>);
+    parser.onUpdate<nmea::Gga>(Queue::onUpdate<nmea::GgaData>);
+    parser.encode((GPRMC + GNGGA).c_str(), GPRMC.length() + GNGGA.length());
+  }
+
+  REQUIRE(queue.pop(event));
+  REQUIRE(event.type == nmea::EventType::Rmc);
+  REQUIRE(event.rmc.latitude_e7 == 525144667);
+  REQUIRE(queue.pop(event));
+  REQUIRE(event.type == nmea::EventType::Gga);
+  REQUIRE(event.gga.num_satellites == 5);
+}
+
+TEST_CASE("GSA data is delivered via the queue", "[EventQueue-06]")
+{
+  typedef nmea::EventQueue<8> Queue;
+  Queue queue;
+  nmea::Event event;
+
+  ArduinoNmeaParser parser(Queue::onUpdate<nmea::RmcData>, Queue::onUpdate<nmea::GgaData>, &queue);
+  parser.setOnGsaUpdate(Queue::onUpdate<nmea::GsaData>);
+
+  std::string const GPGSA = "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n";
+  parser.encode((GPRMC + GPGSA).c_str(), GPRMC.length() + GPGSA.length());
+
+  REQUIRE(queue.pop(event));
+  REQUIRE(event.type == nmea::EventType::Rmc);
+  REQUIRE(queue.pop(event));
+  REQUIRE(event.type == nmea::EventType::Gsa);
+  REQUIRE(event.gsa.fix_type == nmea::FixType::Fix3D);
+  REQUIRE(nmea::numActive(event.gsa, nmea::Constellation::GPS) == 5);
+  REQUIRE_FALSE(queue.pop(event));
+}
+
+TEST_CASE("Consuming events from another thread", "[EventQueue-05]")
+{
+  static int const NUM_EVENTS = 20000;
+
+  WHEN("the oldest events are dropped")
+  {
+    nmea::EventQueue<4, nmea::OverflowPolicy::DropOldest> queue;
+
+    std::thread producer([&queue]()
+    {
+      for (int s = 0; s < NUM_EVENTS; s++)
+        queue.push(makeRmc(s));
+    });
+
+    /* Events may be dropped, but never reordered or corrupted. */
+    int received = 0, last = -1;
+    nmea::Event event;
+    while (last < NUM_EVENTS - 1)
+    {
+      if (!queue.pop(event))
+        continue;
+      REQUIRE(event.type == nmea::EventType::Rmc);
+      REQUIRE(event.rmc.time_utc.second > last);
+      last = event.rmc.time_utc.second;
+      received++;
+    }
+
+    producer.join();
+    REQUIRE(received + queue.overflows() == NUM_EVENTS);
+  }
+
+  WHEN("the newest events are dropped")
+  {
+    nmea::EventQueue<4, nmea::OverflowPolicy::DropNewest> queue;
+
+    std::thread producer([&queue]()
+    {
+      for (int s = 0; s < NUM_EVENTS; s++)
+        while (!queue.push(makeRmc(s)))
+          std::this_thread::yield();
+    });
+
+    nmea::Event event;
+    for (int s = 0; s < NUM_EVENTS; s++)
+    {
+      while (!queue.pop(event))
+        std::this_thread::yield();
+      REQUIRE(event.rmc.time_utc.second == s);
+    }
+
+    producer.join();
+  }
+}
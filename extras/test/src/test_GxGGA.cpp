@@ -53,6 +53,8 @@ SCENARIO("Extracting latitude/longiture from valid GPGGA message", "[GxGGA-03]")
   nmea::GxGGA::parse(const_cast<char *>(GPGGA.c_str()), data);
   REQUIRE(data.latitude  == Approx(48.633433));
   REQUIRE(data.longitude == Approx(13.026492));
+  REQUIRE(data.latitude_e7  == 486334333);
+  REQUIRE(data.longitude_e7 == 130264917);
 }
 
 TEST_CASE("Extracting fix quality angle from valid GxGGA message", "[GxGGA-04]")
@@ -106,3 +108,13 @@ SCENARIO("Extracting DGPS station id from valid GPGGA message", "[GxGGA-10]")
   nmea::GxGGA::parse(const_cast<char *>(GPGGA.c_str()), data);
   REQUIRE(strncmp(data.dgps_id, "0000", 4) == 0);
 }
+
+SCENARIO("Extracting short DGPS station id from valid GPGGA message", "[GxGGA-11]")
+{
+  std::string const GPGGA = "$GPGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,12*79\r\n";
+  nmea::GxGGA::parse(GPGGA.c_str(), data);
+  REQUIRE(data.dgps_id[0] == '1');
+  REQUIRE(data.dgps_id[1] == '2');
+  REQUIRE(data.dgps_id[2] == '\0');
+  REQUIRE(data.dgps_id[3] == '\0');
+}
@@ -0,0 +1,145 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+
+#include <catch.hpp>
+
+#include <nmea/GxGSA.h>
+#include <nmea/util/field.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static nmea::GsaData data;
+
+/* One GNGSA message per constellation, as sent by NMEA 4.10 receivers. */
+static std::string const GNGSA_GPS     = "$GNGSA,A,3,02,05,07,14,15,18,20,23,30,,,,1.60,0.90,1.30,1*05\r\n";
+static std::string const GNGSA_GLONASS = "$GNGSA,A,3,72,80,81,,,,,,,,,,1.60,0.90,1.30,2*0A\r\n";
+static std::string const GNGSA_GALILEO = "$GNGSA,A,3,03,05,08,15,24,25,,,,,,,1.60,0.90,1.30,3*04\r\n";
+static std::string const GNGSA_BDS     = "$GNGSA,A,3,06,09,14,20,22,,,,,,,,1.60,0.90,1.30,4*00\r\n";
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Extracting mode and dilution of precision from a valid GxGSA message", "[GxGSA-01]")
+{
+  std::string const GPGSA = "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n";
+  nmea::GxGSA::parse(GPGSA.c_str(), data);
+
+  REQUIRE(data.source       == nmea::GsaSource::GPS);
+  REQUIRE(data.is_automatic == true);
+  REQUIRE(data.fix_type     == nmea::FixType::Fix3D);
+  REQUIRE(data.pdop         == Approx(2.5f));
+  REQUIRE(data.hdop         == Approx(1.3f));
+  REQUIRE(data.vdop         == Approx(2.1f));
+  REQUIRE(data.system_id    == -1);
+}
+
+TEST_CASE("Extracting the active satellites from a valid GxGSA message", "[GxGSA-02]")
+{
+  std::string const GPGSA = "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n";
+  nmea::GxGSA::parse(GPGSA.c_str(), data);
+
+  REQUIRE(data.active[static_cast<size_t>(nmea::Constellation::GPS)] == ((1ULL << 3) | (1ULL << 4) | (1ULL << 8) | (1ULL << 11) | (1ULL << 23)));
+  REQUIRE(nmea::numActive(data, nmea::Constellation::GPS) == 5);
+  REQUIRE(nmea::numActive(data) == 5);
+  REQUIRE(nmea::isActive(data, nmea::Constellation::GPS, 24));
+  REQUIRE_FALSE(nmea::isActive(data, nmea::Constellation::GPS, 6));
+  REQUIRE_FALSE(nmea::isActive(data, nmea::Constellation::Galileo, 4));
+}
+
+TEST_CASE("Extracting the active satellites from a GNGSA message", "[GxGSA-03]")
+{
+  WHEN("the system id denotes the constellation")
+  {
+    nmea::GxGSA::parse(GNGSA_GALILEO.c_str(), data);
+    REQUIRE(data.source    == nmea::GsaSource::GNSS);
+    REQUIRE(data.system_id == 3);
+    REQUIRE(nmea::numActive(data, nmea::Constellation::Galileo) == 6);
+    REQUIRE(nmea::numActive(data) == 6);
+    REQUIRE(nmea::isActive(data, nmea::Constellation::Galileo, 3));
+    REQUIRE_FALSE(nmea::isActive(data, nmea::Constellation::GPS, 3));
+
+    nmea::GxGSA::parse(GNGSA_GLONASS.c_str(), data);
+    REQUIRE(nmea::numActive(data, nmea::Constellation::GLONASS) == 3);
+    REQUIRE(nmea::isActive(data, nmea::Constellation::GLONASS, 81));
+    REQUIRE(nmea::numActive(data, nmea::Constellation::Galileo) == 0);
+  }
+  WHEN("there is no system id")
+  {
+    std::string const GNGSA = "$GNGSA,M,2,193,301,401,,,,,,,,,,2.0,1.0,1.7*18\r\n";
+    nmea::GxGSA::parse(GNGSA.c_str(), data);
+    REQUIRE(data.is_automatic == false);
+    REQUIRE(data.fix_type     == nmea::FixType::Fix2D);
+    REQUIRE(nmea::isActive(data, nmea::Constellation::QZSS,    193));
+    REQUIRE(nmea::isActive(data, nmea::Constellation::Galileo, 301));
+    REQUIRE(nmea::isActive(data, nmea::Constellation::BDS,     401));
+    REQUIRE(nmea::numActive(data) == 3);
+  }
+}
+
+TEST_CASE("Merging the GNGSA messages of all constellations", "[GxGSA-04]")
+{
+  nmea::GsaData latest = nmea::INVALID_GSA;
+
+  for (std::string const & gngsa : {GNGSA_GPS, GNGSA_GLONASS, GNGSA_GALILEO, GNGSA_BDS})
+  {
+    nmea::GxGSA::parse(gngsa.c_str(), data);
+    nmea::GxGSA::merge(data, latest);
+  }
+
+  REQUIRE(nmea::numActive(latest, nmea::Constellation::GPS)     == 9);
+  REQUIRE(nmea::numActive(latest, nmea::Constellation::GLONASS) == 3);
+  REQUIRE(nmea::numActive(latest, nmea::Constellation::Galileo) == 6);
+  REQUIRE(nmea::numActive(latest, nmea::Constellation::BDS)     == 5);
+  REQUIRE(nmea::numActive(latest) == 23);
+  REQUIRE(latest.pdop == Approx(1.6f));
+
+  WHEN("a constellation is updated")
+  {
+    std::string const GNGSA = "$GNGSA,A,3,02,05,07,14,15,18,20,23,,,,,1.70,1.00,1.40,1*08\r\n";
+    nmea::GxGSA::parse(GNGSA.c_str(), data);
+    nmea::GxGSA::merge(data, latest);
+
+    REQUIRE(nmea::numActive(latest, nmea::Constellation::GPS) == 8);
+    REQUIRE(nmea::numActive(latest) == 22);
+    REQUIRE(latest.pdop == Approx(1.7f));
+  }
+  WHEN("a GNGSA message without system id and satellites arrives")
+  {
+    std::string const GNGSA = "$GNGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*2E\r\n";
+    nmea::GxGSA::parse(GNGSA.c_str(), data);
+    nmea::GxGSA::merge(data, latest);
+
+    REQUIRE(latest.fix_type == nmea::FixType::NoFix);
+    REQUIRE(nmea::numActive(latest) == 0);
+  }
+}
+
+TEST_CASE("Decoding a GxGSA message field by field", "[GxGSA-05]")
+{
+  nmea::GxGSA::parse(GNGSA_BDS.c_str(), data);
+
+  nmea::util::FieldIndex index;
+  nmea::util::buildFieldIndex(GNGSA_BDS.c_str(), index);
+
+  nmea::GsaData by_field = nmea::INVALID_GSA;
+  for (size_t f = 0; f < index.num_fields; f++)
+    nmea::GxGSA::parseField(f, GNGSA_BDS.c_str() + index.field[f].offset, index.field[f].length, nmea::GsaSource::GNSS, by_field);
+
+  REQUIRE(by_field.system_id == 4);
+  REQUIRE(by_field.hdop      == data.hdop);
+  for (size_t c = 0; c < nmea::NUM_CONSTELLATIONS; c++)
+    REQUIRE(by_field.active[c] == data.active[c]);
+}
@@ -0,0 +1,123 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+
+#include <catch.hpp>
+
+#include <nmea/GxGSV.h>
+#include <nmea/util/field.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static nmea::GsvData data;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static void requireSatellite(nmea::SatelliteInView const & satellite, int const id, int const elevation, int const azimuth, int const snr)
+{
+  REQUIRE(satellite.id        == id);
+  REQUIRE(satellite.elevation == elevation);
+  REQUIRE(satellite.azimuth   == azimuth);
+  REQUIRE(satellite.snr       == snr);
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Extracting the sequence information from a valid GxGSV message", "[GxGSV-01]")
+{
+  std::string const GPGSV = "$GPGSV,3,1,11,02,14,074,,05,35,185,32,07,49,259,48,13,01,121,,1*65\r\n";
+  nmea::GxGSV::parse(GPGSV.c_str(), data);
+
+  REQUIRE(data.source         == nmea::GsvSource::GPS);
+  REQUIRE(data.num_messages   == 3);
+  REQUIRE(data.message_number == 1);
+  REQUIRE(data.num_satellites == 11);
+  REQUIRE(data.signal_id      == 1);
+}
+
+TEST_CASE("Extracting the satellites from a valid GxGSV message", "[GxGSV-02]")
+{
+  std::string const GPGSV = "$GPGSV,3,1,11,02,14,074,,05,35,185,32,07,49,259,48,13,01,121,,1*65\r\n";
+  nmea::GxGSV::parse(GPGSV.c_str(), data);
+
+  REQUIRE(data.num_entries == 4);
+  requireSatellite(data.satellite[0],  2, 14,  74, -1);
+  requireSatellite(data.satellite[1],  5, 35, 185, 32);
+  requireSatellite(data.satellite[2],  7, 49, 259, 48);
+  requireSatellite(data.satellite[3], 13,  1, 121, -1);
+}
+
+TEST_CASE("Extracting the last GxGSV message of a sequence", "[GxGSV-03]")
+{
+  WHEN("followed by the signal id")
+  {
+    std::string const GAGSV = "$GAGSV,3,3,09,34,58,178,40,7*4A\r\n";
+    nmea::GxGSV::parse(GAGSV.c_str(), data);
+    REQUIRE(data.source      == nmea::GsvSource::Galileo);
+    REQUIRE(data.num_entries == 1);
+    REQUIRE(data.signal_id   == 7);
+    requireSatellite(data.satellite[0], 34, 58, 178, 40);
+  }
+  WHEN("without signal id (prior to NMEA 4.10)")
+  {
+    std::string const GPGSV = "$GPGSV,3,3,11,14,25,170,00,16,57,208,39,18,67,296,40*49\r\n";
+    nmea::GxGSV::parse(GPGSV.c_str(), data);
+    REQUIRE(data.num_entries == 3);
+    REQUIRE(data.signal_id   == -1);
+    requireSatellite(data.satellite[2], 18, 67, 296, 40);
+  }
+  WHEN("no satellites are in view")
+  {
+    std::string const GPGSV = "$GPGSV,1,1,00,1*64\r\n";
+    nmea::GxGSV::parse(GPGSV.c_str(), data);
+    REQUIRE(data.num_satellites == 0);
+    REQUIRE(data.num_entries    == 0);
+    REQUIRE(data.signal_id      == 1);
+  }
+}
+
+TEST_CASE("Extracting a GQGSV message", "[GxGSV-04]")
+{
+  std::string const GQGSV = "$GQGSV,1,1,02,193,45,120,38,194,12,300,*74\r\n";
+  nmea::GxGSV::parse(GQGSV.c_str(), data);
+
+  REQUIRE(data.source      == nmea::GsvSource::QZSS);
+  REQUIRE(data.num_entries == 2);
+  requireSatellite(data.satellite[0], 193, 45, 120, 38);
+  requireSatellite(data.satellite[1], 194, 12, 300, -1);
+}
+
+TEST_CASE("Decoding a GxGSV message field by field", "[GxGSV-05]")
+{
+  std::string const GLGSV = "$GLGSV,2,2,07,80,20,080,48,81,27,117,38,88,76,016,48,1*4B\r\n";
+  nmea::GxGSV::parse(GLGSV.c_str(), data);
+
+  nmea::util::FieldIndex index;
+  nmea::util::buildFieldIndex(GLGSV.c_str(), index);
+
+  /* Nothing is carried over from the previously decoded message. */
+  nmea::GsvData by_field = data;
+  by_field.num_entries = 4;
+  for (size_t f = 0; f < index.num_fields; f++)
+    nmea::GxGSV::parseField(f, GLGSV.c_str() + index.field[f].offset, index.field[f].length, nmea::GsvSource::GLONASS, by_field);
+
+  REQUIRE(by_field.num_entries == 3);
+  REQUIRE(by_field.signal_id   == data.signal_id);
+  for (size_t s = 0; s < data.num_entries; s++)
+    requireSatellite(by_field.satellite[s], data.satellite[s].id, data.satellite[s].elevation, data.satellite[s].azimuth, data.satellite[s].snr);
+}
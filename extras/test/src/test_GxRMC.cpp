@@ -37,6 +37,8 @@ SCENARIO("Extracting latitude/longiture from valid GPRMC message", "[GxRMC-01]")
 
     REQUIRE(data.latitude  == Approx(50.03114442));
     REQUIRE(data.longitude == Approx(19.20189679));
+    REQUIRE(data.latitude_e7  == 500311500);
+    REQUIRE(data.longitude_e7 == 192019000);
   }
 
   WHEN("north/west")
@@ -47,6 +49,8 @@ SCENARIO("Extracting latitude/longiture from valid GPRMC message", "[GxRMC-01]")
 
     REQUIRE(data.latitude  == Approx(40.9458060446613));
     REQUIRE(data.longitude == Approx(-112.210235595703));
+    REQUIRE(data.latitude_e7  == 409458000);
+    REQUIRE(data.longitude_e7 == -1122102333);
   }
 
   WHEN("south/west")
@@ -57,6 +61,8 @@ SCENARIO("Extracting latitude/longiture from valid GPRMC message", "[GxRMC-01]")
 
     REQUIRE(data.latitude  == Approx(-27.4511422937699));
     REQUIRE(data.longitude == Approx(-58.986502289772));
+    REQUIRE(data.latitude_e7  == -274511500);
+    REQUIRE(data.longitude_e7 == -589865000);
   }
 
   WHEN("south/east")
@@ -67,6 +73,8 @@ SCENARIO("Extracting latitude/longiture from valid GPRMC message", "[GxRMC-01]")
 
     REQUIRE(data.latitude  == Approx(-6.17536097471491));
     REQUIRE(data.longitude == Approx(106.827192306519));
+    REQUIRE(data.latitude_e7  == -61753667);
+    REQUIRE(data.longitude_e7 == 1068272000);
   }
 }
 
@@ -164,3 +172,25 @@ TEST_CASE("GxRMC message contains only date and time, but no location fix yet ",
   REQUIRE(data.date.month           == 11);
   REQUIRE(data.date.year            == 2020);
 }
+
+TEST_CASE("Parsing a GxRMC message does not modify it", "[GxRMC-10]")
+{
+  std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+  std::string const GPRMC_COPY = GPRMC;
+  nmea::RmcData data;
+  nmea::GxRMC::parse(GPRMC.c_str(), data);
+  REQUIRE(GPRMC == GPRMC_COPY);
+  REQUIRE(data.date.year == 2020);
+}
+
+TEST_CASE("Extracting high precision latitude/longitude from valid GxRMC message", "[GxRMC-11]")
+{
+  std::string const GNRMC = "$GNRMC,142600.00,A,4837.9947412,N,01301.5345278,W,0.020,,121020,,,R*4C\r\n";
+  nmea::RmcData data;
+  nmea::GxRMC::parse(GNRMC.c_str(), data);
+
+  /* 48 + 37.9947412 / 60 = 48.63324568666 */
+  REQUIRE(data.latitude_e7  == 486332457);
+  /* 13 +  1.5345278 / 60 = 13.02557546333 */
+  REQUIRE(data.longitude_e7 == -130255755);
+}
@@ -0,0 +1,229 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const NMEA_STREAM =
+  "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n"
+  "$GPGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*7A\r\n"
+  "$GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39\r\n"
+  "$GPRMC,052853.105,A,5230.888,N,01320.967,E,084.5,069.2,080720,000.0,W*7A\r\n"
+  "$GPRMC,052853.105,A,5230.888,N,01320.967,E,084.5,069.2,080720,000.0,W*00\r\n";
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+typedef struct
+{
+  std::vector<int> rmc_seconds;
+  std::vector<int> gga_seconds;
+} Context;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static void onRmcUpdate(nmea::RmcData const & rmc, void * context)
+{
+  static_cast<Context *>(context)->rmc_seconds.push_back(rmc.time_utc.second);
+}
+
+static void onGgaUpdate(nmea::GgaData const & gga, void * context)
+{
+  static_cast<Context *>(context)->gga_seconds.push_back(gga.time_utc.second);
+}
+
+static void onRmcProvisional(nmea::RmcData const & /* rmc */, nmea::Provisional const available, void * context)
+{
+  static_cast<std::vector<std::string> *>(context)->push_back((available == nmea::Provisional::Time) ? "time" : "position");
+}
+
+static void onVerdict(nmea::Verdict const verdict, void * context)
+{
+  static_cast<std::vector<std::string> *>(context)->push_back((verdict == nmea::Verdict::Confirmed) ? "confirmed" : "retracted");
+}
+
+static void onSkyView(nmea::SkyView const & sky_view, void * context)
+{
+  static_cast<std::vector<nmea::SkyView> *>(context)->push_back(sky_view);
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("NmeaParser only decodes the selected NMEA messages", "[NmeaParser-01]")
+{
+  Context context;
+
+  WHEN("only RMC is selected")
+  {
+    nmea::NmeaParser<nmea::Rmc> parser(&context);
+    parser.onUpdate<nmea::Rmc>(onRmcUpdate);
+
+    parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+
+    REQUIRE(context.rmc_seconds == std::vector<int>({52, 53}));
+    REQUIRE(context.gga_seconds.empty());
+    REQUIRE(parser.data<nmea::Rmc>().latitude_e7 == 525148000);
+    REQUIRE(parser.error() == nmea::NmeaParser<nmea::Rmc>::Error::Checksum);
+  }
+
+  WHEN("only GGA is selected")
+  {
+    nmea::NmeaParser<nmea::Gga> parser(&context);
+    parser.onUpdate<nmea::Gga>(onGgaUpdate);
+
+    for (char const c : NMEA_STREAM)
+      parser.encode(c);
+
+    REQUIRE(context.rmc_seconds.empty());
+    REQUIRE(context.gga_seconds == std::vector<int>({8}));
+    REQUIRE(parser.data<nmea::Gga>().num_satellites == 5);
+  }
+
+  WHEN("RMC and GGA are selected in reverse order")
+  {
+    nmea::NmeaParser<nmea::Gga, nmea::Rmc> parser(&context);
+    parser.onUpdate<nmea::Rmc>(onRmcUpdate);
+    parser.onUpdate<nmea::Gga>(onGgaUpdate);
+
+    parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+
+    REQUIRE(context.rmc_seconds == std::vector<int>({52, 53}));
+    REQUIRE(context.gga_seconds == std::vector<int>({8}));
+  }
+}
+
+TEST_CASE("NmeaParser without callbacks", "[NmeaParser-02]")
+{
+  nmea::NmeaParser<nmea::Rmc, nmea::Gga> parser;
+
+  REQUIRE(parser.data<nmea::Rmc>().source == nmea::RmcSource::Unknown);
+  REQUIRE(std::isnan(parser.data<nmea::Gga>().altitude));
+
+  parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+
+  REQUIRE(parser.data<nmea::Rmc>().time_utc.second == 53);
+  REQUIRE(parser.data<nmea::Gga>().time_utc.second == 8);
+  REQUIRE(parser.toPosixTimestamp(parser.data<nmea::Rmc>().date, parser.data<nmea::Rmc>().time_utc) == 1594186133);
+}
+
+TEST_CASE("NmeaParser decodes the same values as ArduinoNmeaParser", "[NmeaParser-03]")
+{
+  nmea::NmeaParser<nmea::Rmc, nmea::Gga> parser;
+  ArduinoNmeaParser reference(nullptr, nullptr, nullptr);
+
+  parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+  reference.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+
+  REQUIRE(parser.data<nmea::Rmc>().latitude     == reference.rmc().latitude);
+  REQUIRE(parser.data<nmea::Rmc>().longitude_e7 == reference.rmc().longitude_e7);
+  REQUIRE(parser.data<nmea::Rmc>().speed        == reference.rmc().speed);
+  REQUIRE(parser.data<nmea::Gga>().altitude     == reference.gga().altitude);
+  REQUIRE(parser.data<nmea::Gga>().hdop         == reference.gga().hdop);
+}
+
+TEST_CASE("NmeaParser only reserves storage for the selected NMEA messages", "[NmeaParser-04]")
+{
+  REQUIRE(sizeof(nmea::NmeaParser<nmea::Rmc>) < sizeof(nmea::NmeaParser<nmea::Rmc, nmea::Gga>));
+  REQUIRE(sizeof(nmea::NmeaParser<nmea::Gga>) < sizeof(nmea::NmeaParser<nmea::Rmc, nmea::Gga>));
+}
+
+TEST_CASE("NmeaParser ingests a circular buffer", "[NmeaParser-05]")
+{
+  Context context;
+  nmea::NmeaParser<nmea::Rmc, nmea::Gga> parser(&context);
+  parser.onUpdate<nmea::Rmc>(onRmcUpdate);
+  parser.onUpdate<nmea::Gga>(onGgaUpdate);
+
+  /* Chunks of 50 characters, wrapping around the 64 character ring. */
+  char ring[64];
+  size_t head = 0;
+  for (size_t pos = 0; pos < NMEA_STREAM.length(); pos += 50)
+  {
+    size_t const tail = head;
+    for (size_t i = pos; i < std::min(pos + 50, NMEA_STREAM.length()); i++)
+    {
+      ring[head] = NMEA_STREAM[i];
+      head = (head + 1) % sizeof(ring);
+    }
+    parser.encodeRing(ring, sizeof(ring), tail, head);
+  }
+
+  REQUIRE(context.rmc_seconds == std::vector<int>({52, 53}));
+  REQUIRE(context.gga_seconds == std::vector<int>({8}));
+  REQUIRE(parser.error() == nmea::NmeaParser<nmea::Rmc, nmea::Gga>::Error::Checksum);
+}
+
+TEST_CASE("NmeaParser decodes the same values when streaming", "[NmeaParser-06]")
+{
+  nmea::NmeaParser<nmea::Rmc, nmea::Gga> parser;
+  nmea::NmeaParser<nmea::Rmc, nmea::Gga> streaming_parser;
+  streaming_parser.setStreamingDecode(true);
+
+  parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+  for (char const c : NMEA_STREAM)
+    streaming_parser.encode(c);
+
+  REQUIRE(streaming_parser.data<nmea::Rmc>().time_utc.second == parser.data<nmea::Rmc>().time_utc.second);
+  REQUIRE(streaming_parser.data<nmea::Rmc>().latitude_e7     == parser.data<nmea::Rmc>().latitude_e7);
+  REQUIRE(streaming_parser.data<nmea::Rmc>().speed           == parser.data<nmea::Rmc>().speed);
+  REQUIRE(streaming_parser.data<nmea::Gga>().altitude        == parser.data<nmea::Gga>().altitude);
+  REQUIRE(streaming_parser.decodedMessages<nmea::Rmc>() == 2);
+}
+
+TEST_CASE("NmeaParser dispatches RMC data early", "[NmeaParser-07]")
+{
+  std::vector<std::string> events;
+  nmea::NmeaParser<nmea::Rmc> parser(&events);
+  parser.onProvisional<nmea::Rmc>(onRmcProvisional);
+  parser.onVerdict(onVerdict);
+
+  parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+
+  REQUIRE(events == std::vector<std::string>({"time", "position", "confirmed",
+                                              "time", "position", "confirmed",
+                                              "time", "position", "retracted"}));
+}
+
+TEST_CASE("NmeaParser assembles the sky view if GSV is selected", "[NmeaParser-08]")
+{
+  static std::string const GPGSV =
+    "$GPGSV,3,1,11,02,14,074,,05,35,185,32,07,49,259,48,13,01,121,,1*65\r\n"
+    "$GPGSV,3,2,11,14,08,158,,15,15,195,27,18,36,306,39,20,50,020,,1*6A\r\n"
+    "$GPGSV,3,3,11,23,71,131,26,30,30,030,46,27,09,279,41,1*50\r\n";
+
+  std::vector<nmea::SkyView> sky_views;
+  nmea::SkyViewAssembler assembler(onSkyView, &sky_views);
+  nmea::NmeaParser<nmea::Rmc, nmea::Gsv> parser;
+  parser.setSkyView(&assembler);
+
+  parser.encode(GPGSV.c_str(), GPGSV.length());
+  REQUIRE(sky_views.empty());
+  parser.encode(NMEA_STREAM.c_str(), NMEA_STREAM.length());
+
+  REQUIRE(sky_views.size() == 1);
+  REQUIRE(sky_views[0].constellation[static_cast<size_t>(nmea::Constellation::GPS)].num_entries == 11);
+  REQUIRE(parser.decodedMessages<nmea::Gsv>() == 3);
+}
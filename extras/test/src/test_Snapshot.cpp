@@ -0,0 +1,109 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+
+#include <ArduinoNmeaParser.h>
+#include <nmea/Snapshot.h>
+
+/**************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************/
+
+static std::string const GPRMC = "$GPRMC,052852.105,A,5230.868,N,01320.958,E,077.0,023.5,080720,000.0,W*79\r\n";
+static std::string const GNGGA = "$GNGGA,111908.952,4838.0060,N,01301.5895,E,1,05,2.4,454.7,M,46.6,M,0.0,0000*64\r\n";
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("A snapshot returns the latest stored value", "[Snapshot-01]")
+{
+  nmea::Snapshot<nmea::Time> snapshot(nmea::INVALID_TIME);
+
+  REQUIRE(snapshot.version() == 0);
+  REQUIRE(snapshot.load().hour == -1);
+
+  snapshot.store(nmea::Time{5, 28, 52, 105000});
+  REQUIRE(snapshot.version() == 1);
+
+  nmea::Time const time = snapshot.load();
+  REQUIRE(time.hour        == 5);
+  REQUIRE(time.minute      == 28);
+  REQUIRE(time.second      == 52);
+  REQUIRE(time.microsecond == 105000);
+}
+
+TEST_CASE("LatestFix is filled via the update callbacks of the parser", "[Snapshot-02]")
+{
+  nmea::LatestFix fix;
+  ArduinoNmeaParser parser(nmea::LatestFix::onUpdate<nmea::RmcData>,
+                           nmea::LatestFix::onUpdate<nmea::GgaData>,
+                           &fix);
+
+  REQUIRE_FALSE(fix.rmc().is_valid);
+  REQUIRE(fix.gga().num_satellites == -1);
+
+  parser.encode(GPRMC.c_str(), GPRMC.length());
+  parser.encode(GNGGA.c_str(), GNGGA.length());
+
+  REQUIRE(fix.rmcSnapshot().version() == 1);
+  REQUIRE(fix.ggaSnapshot().version() == 1);
+
+  nmea::RmcData const rmc = fix.rmc();
+  REQUIRE(rmc.is_valid);
+  REQUIRE(rmc.time_utc.second == 52);
+  REQUIRE(rmc.latitude_e7 == parser.rmc().latitude_e7);
+
+  nmea::GgaData const gga = fix.gga();
+  REQUIRE(gga.source == nmea::GgaSource::GNSS);
+  REQUIRE(gga.num_satellites == 5);
+}
+
+TEST_CASE("Concurrent readers never observe a torn value", "[Snapshot-03]")
+{
+  /* Every stored value has all members set to the same number,
+   * a reader seeing different members caught a partial store.
+   */
+  size_t const NUM_READERS = 4;
+  int    const NUM_STORES  = 100000;
+
+  nmea::Snapshot<nmea::Time> snapshot(nmea::Time{0, 0, 0, 0});
+  std::vector<size_t> torn(NUM_READERS, 0);
+  std::vector<std::thread> readers;
+
+  for (size_t r = 0; r < NUM_READERS; r++)
+    readers.emplace_back([r, &snapshot, &torn]()
+                         {
+                           int last = 0;
+                           while (last < NUM_STORES)
+                           {
+                             nmea::Time const time = snapshot.load();
+                             if (time.minute != time.hour || time.second != time.hour || time.microsecond != time.hour || time.hour < last)
+                               torn[r]++;
+                             last = time.hour;
+                           }
+                         });
+
+  for (int s = 1; s <= NUM_STORES; s++)
+    snapshot.store(nmea::Time{s, s, s, s});
+
+  for (std::thread & thd : readers)
+    thd.join();
+
+  for (size_t r = 0; r < NUM_READERS; r++)
+    REQUIRE(torn[r] == 0);
+  REQUIRE(snapshot.version() == static_cast<uint32_t>(NUM_STORES));
+}
@@ -9,6 +9,8 @@
  * INCLUDE
  **************************************************************************************/
 
+#include <time.h>
+
 #include <catch.hpp>
 
 #include <nmea/Types.h>
@@ -37,6 +39,62 @@ TEST_CASE("Convert date/time to POSIX timestamp with time.microseconds < 500", "
   REQUIRE(posix_timestamp == 1603978646 - 1);
 }
 
+TEST_CASE("'toEpochDay(...)' yields the same result as 'timegm(...)' for every day between 1970 and 2199", "[toEpochDay-01]")
+{
+  time_t const SECONDS_PER_DAY = 86400;
+
+  for (int year = 1970; year < 2200; year++)
+    for (int month = 1; month <= 12; month++)
+      for (int day = 1; day <= 31; day++)
+      {
+        struct tm tm = {};
+        tm.tm_mday = day;
+        tm.tm_mon  = month - 1;
+        tm.tm_year = year - 1900;
+        time_t const expected = timegm(&tm);
+
+        nmea::Date const date = {day, month, year};
+
+        /* timegm normalises non-existing days, e.g. 31.04. into 01.05. */
+        if (tm.tm_mday != day)
+          REQUIRE(nmea::toEpochDay(date) == nmea::INVALID_EPOCH_DAY);
+        else
+          REQUIRE(nmea::toEpochDay(date) == expected / SECONDS_PER_DAY);
+      }
+}
+
+TEST_CASE("Invalid date/time yields an invalid POSIX timestamp", "[toPosixTimestamp-03]")
+{
+  nmea::Time const time = {13,37,25,322};
+
+  REQUIRE(nmea::toPosixTimestamp(nmea::INVALID_DATE, time) == -1);
+  REQUIRE(nmea::toPosixTimestamp(nmea::Date{29,2,2021}, time) == -1);
+  REQUIRE(nmea::toPosixTimestamp(nmea::Date{29,10,2020}, nmea::INVALID_TIME) == -1);
+  REQUIRE(nmea::toPosixTimestamp(nmea::Date{29,10,2020}, nmea::Time{24,0,0,0}) == -1);
+}
+
+TEST_CASE("Convert date/time to POSIX timestamp using a cached epoch day", "[toPosixTimestamp-04]")
+{
+  nmea::EpochDayCache cache = nmea::INVALID_EPOCH_DAY_CACHE;
+
+  nmea::Date const date = {29,10,2020};
+  nmea::Time const time = {13,37,25,689};
+
+  REQUIRE(nmea::toPosixTimestamp(date, time, cache) == 1603978646);
+  REQUIRE(cache.epoch_day == 1603978646 / 86400);
+
+  nmea::Time const time_next = {13,37,26,689};
+  REQUIRE(nmea::toPosixTimestamp(date, time_next, cache) == 1603978647);
+
+  /* A changed date updates the cache. */
+  nmea::Date const date_next = {30,10,2020};
+  REQUIRE(nmea::toPosixTimestamp(date_next, time, cache) == 1603978646 + 86400);
+  REQUIRE(cache.epoch_day == 1603978646 / 86400 + 1);
+
+  /* An invalid date yields an invalid timestamp via the cache too. */
+  REQUIRE(nmea::toPosixTimestamp(nmea::INVALID_DATE, time, cache) == -1);
+}
+
 TEST_CASE("Testing isValid(Date const &)", "[isValid(Date)-01]")
 {
   WHEN ("Date is valid")
@@ -37,3 +37,61 @@ TEST_CASE("NMEA message with invalid checksum", "[checksum-03]")
   std::string const GPRMC_CHECKSUM_ERROR = "$GPRMC,062101.714,A,5001.869,N,01912.114,E,955535.7,116.2,290520,000.0,W*FF\r\n";
   REQUIRE(nmea::util::isChecksumOk(GPRMC_CHECKSUM_ERROR.c_str()) == false);
 }
+
+TEST_CASE("NMEA message with lower case checksum digits", "[checksum-04]")
+{
+  std::string const GPRMC_CHECKSUM_OK = "$GPRMC,142600.00,A,4837.99474,N,01301.53452,E,27.920,247.03,121020,,,A*5a\r\n";
+  REQUIRE(nmea::util::isChecksumOk(GPRMC_CHECKSUM_OK.c_str()) == true);
+}
+
+TEST_CASE("Testing 'hexDigitToNibble(...)' with valid and invalid hexadecimal digits", "[hexDigitToNibble-01]")
+{
+  WHEN("valid hexadecimal digits")
+  {
+    REQUIRE(nmea::util::hexDigitToNibble('0') == 0);
+    REQUIRE(nmea::util::hexDigitToNibble('9') == 9);
+    REQUIRE(nmea::util::hexDigitToNibble('A') == 10);
+    REQUIRE(nmea::util::hexDigitToNibble('F') == 15);
+    REQUIRE(nmea::util::hexDigitToNibble('a') == 10);
+    REQUIRE(nmea::util::hexDigitToNibble('f') == 15);
+  }
+  WHEN("invalid hexadecimal digits")
+  {
+    REQUIRE(nmea::util::hexDigitToNibble('/')  == nmea::util::INVALID_HEX_DIGIT);
+    REQUIRE(nmea::util::hexDigitToNibble(':')  == nmea::util::INVALID_HEX_DIGIT);
+    REQUIRE(nmea::util::hexDigitToNibble('@')  == nmea::util::INVALID_HEX_DIGIT);
+    REQUIRE(nmea::util::hexDigitToNibble('G')  == nmea::util::INVALID_HEX_DIGIT);
+    REQUIRE(nmea::util::hexDigitToNibble('`')  == nmea::util::INVALID_HEX_DIGIT);
+    REQUIRE(nmea::util::hexDigitToNibble('g')  == nmea::util::INVALID_HEX_DIGIT);
+    REQUIRE(nmea::util::hexDigitToNibble('*')  == nmea::util::INVALID_HEX_DIGIT);
+    REQUIRE(nmea::util::hexDigitToNibble('\r') == nmea::util::INVALID_HEX_DIGIT);
+  }
+}
+
+TEST_CASE("Testing 'updateChecksum(...)' accumulating the checksum in multiple steps", "[updateChecksum-01]")
+{
+  std::string const GPRMC_BODY = "GPRMC,193517.00,A,4837.99895,N,01301.58584,E,0.793,,111020,,,A";
+
+  uint8_t checksum = 0;
+  checksum = nmea::util::updateChecksum(checksum, GPRMC_BODY.data(), 10);
+  checksum = nmea::util::updateChecksum(checksum, GPRMC_BODY.data() + 10, GPRMC_BODY.length() - 10);
+
+  REQUIRE(checksum == 0x7D);
+}
+
+TEST_CASE("NMEA message without checksum does not affect the following NMEA message", "[checksum-05]")
+{
+  std::string const GPRMC_NO_CHECKSUM = "$GPRMC,062101.714,A,5001.869,N,01912.114,E,955535.7,116.2,290520,000.0,W\r\n";
+  std::string const GPRMC_CHECKSUM_OK = "$GPRMC,062101.714,A,5001.869,N,01912.114,E,955535.7,116.2,290520,000.0,W*45\r\n";
+
+  REQUIRE(nmea::util::isChecksumOk(GPRMC_NO_CHECKSUM.c_str()) == false);
+  REQUIRE(nmea::util::isChecksumOk(GPRMC_CHECKSUM_OK.c_str()) == true);
+}
+
+TEST_CASE("NMEA message truncated after the start of the checksum", "[checksum-06]")
+{
+  REQUIRE(nmea::util::isChecksumOk("$GPRMC,,V,,,,,,,,,,N*")  == false);
+  REQUIRE(nmea::util::isChecksumOk("$GPRMC,,V,,,,,,,,,,N*5") == false);
+  REQUIRE(nmea::util::isChecksumOk("GPRMC,,V,,,,,,,,,,N*53") == false);
+  REQUIRE(nmea::util::isChecksumOk("$GPRMC,,V,,,,,,,,,,N*53") == true);
+}
@@ -0,0 +1,91 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <catch.hpp>
+
+#include <nmea/util/dispatch.h>
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+static nmea::util::Formatter constexpr COMMON_FORMATTERS[] =
+{
+  nmea::util::toFormatter('R', 'M', 'C'),
+  nmea::util::toFormatter('G', 'G', 'A'),
+  nmea::util::toFormatter('G', 'S', 'A'),
+  nmea::util::toFormatter('G', 'S', 'V'),
+  nmea::util::toFormatter('V', 'T', 'G'),
+  nmea::util::toFormatter('G', 'L', 'L'),
+  nmea::util::toFormatter('Z', 'D', 'A'),
+  nmea::util::toFormatter('G', 'S', 'T'),
+  nmea::util::toFormatter('G', 'N', 'S'),
+  nmea::util::toFormatter('T', 'X', 'T'),
+  nmea::util::toFormatter('H', 'D', 'T'),
+  nmea::util::toFormatter('G', 'B', 'S'),
+  nmea::util::toFormatter('D', 'T', 'M'),
+  nmea::util::toFormatter('G', 'R', 'S'),
+};
+
+static_assert(nmea::util::isCollisionFree(COMMON_FORMATTERS), "Common NMEA formatters must not collide within the dispatch table");
+
+static nmea::util::Formatter constexpr COLLIDING_FORMATTERS[] =
+{
+  nmea::util::toFormatter('R', 'M', 'C'),
+  nmea::util::toFormatter('X', 'M', 'C'), /* Only differs in the first character which is ignored by the hash. */
+};
+
+static_assert(!nmea::util::isCollisionFree(COLLIDING_FORMATTERS), "Colliding formatters must be detected");
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Testing 'parseFormatter(...)'", "[parseFormatter-01]")
+{
+  REQUIRE(nmea::util::parseFormatter("$GPRMC", 6) == nmea::util::toFormatter('R', 'M', 'C'));
+  REQUIRE(nmea::util::parseFormatter("$BDGGA", 6) == nmea::util::toFormatter('G', 'G', 'A'));
+  REQUIRE(nmea::util::parseFormatter("$GPRM",  5) == nmea::util::INVALID_FORMATTER);
+  REQUIRE(nmea::util::parseFormatter("$GPRMCX",7) == nmea::util::INVALID_FORMATTER);
+  REQUIRE(nmea::util::parseFormatter("$GPrmc", 6) == nmea::util::INVALID_FORMATTER);
+}
+
+TEST_CASE("Testing 'parseTalker(...)'", "[parseTalker-01]")
+{
+  REQUIRE(nmea::util::parseTalker("$GPRMC", 6) == nmea::RmcSource::GPS);
+  REQUIRE(nmea::util::parseTalker("$GLRMC", 6) == nmea::RmcSource::GLONASS);
+  REQUIRE(nmea::util::parseTalker("$GARMC", 6) == nmea::RmcSource::Galileo);
+  REQUIRE(nmea::util::parseTalker("$GNRMC", 6) == nmea::RmcSource::GNSS);
+  REQUIRE(nmea::util::parseTalker("$BDRMC", 6) == nmea::RmcSource::BDS);
+  REQUIRE(nmea::util::parseTalker("$GBRMC", 6) == nmea::RmcSource::BDS);
+  REQUIRE(nmea::util::parseTalker("$GQRMC", 6) == nmea::RmcSource::QZSS);
+  REQUIRE(nmea::util::parseTalker("$XXRMC", 6) == nmea::RmcSource::Unknown);
+  REQUIRE(nmea::util::parseTalker("$GPRM",  5) == nmea::RmcSource::Unknown);
+}
+
+TEST_CASE("Testing 'makeDispatchTable(...)'", "[makeDispatchTable-01]")
+{
+  static nmea::util::DispatchTable constexpr DISPATCH_TABLE = nmea::util::makeDispatchTable(COMMON_FORMATTERS);
+
+  size_t const NUM_FORMATTERS = sizeof(COMMON_FORMATTERS) / sizeof(COMMON_FORMATTERS[0]);
+
+  /* Every formatter is found in its slot ... */
+  for (size_t f = 0; f < NUM_FORMATTERS; f++)
+    REQUIRE(DISPATCH_TABLE.entry[nmea::util::toDispatchSlot(COMMON_FORMATTERS[f])] == f);
+
+  /* ... and all other slots are empty. */
+  size_t num_empty_slots = 0;
+  for (size_t s = 0; s < nmea::util::DISPATCH_TABLE_SIZE; s++)
+    if (DISPATCH_TABLE.entry[s] == nmea::util::DISPATCH_SLOT_EMPTY)
+      num_empty_slots++;
+
+  REQUIRE(num_empty_slots == (nmea::util::DISPATCH_TABLE_SIZE - NUM_FORMATTERS));
+}
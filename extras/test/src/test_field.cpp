@@ -0,0 +1,78 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <string>
+
+#include <catch.hpp>
+
+#include <nmea/util/field.h>
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static std::string field(std::string const & nmea, nmea::util::FieldIndex const & index, size_t const f)
+{
+  return nmea.substr(index.field[f].offset, index.field[f].length);
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Testing 'buildFieldIndex(...)' with a complete NMEA message", "[buildFieldIndex-01]")
+{
+  std::string const GPRMC = "$GPRMC,142600.00,A,4837.99474,N,01301.53452,E,27.920,247.03,121020,,,A*5A\r\n";
+  std::string const GPRMC_COPY = GPRMC;
+
+  nmea::util::FieldIndex index;
+  nmea::util::buildFieldIndex(GPRMC.c_str(), index);
+
+  REQUIRE(index.num_fields == 13);
+  REQUIRE(field(GPRMC, index,  0) == "$GPRMC");
+  REQUIRE(field(GPRMC, index,  1) == "142600.00");
+  REQUIRE(field(GPRMC, index,  2) == "A");
+  REQUIRE(field(GPRMC, index,  3) == "4837.99474");
+  REQUIRE(field(GPRMC, index,  9) == "121020");
+  REQUIRE(field(GPRMC, index, 10) == "");
+  REQUIRE(field(GPRMC, index, 11) == "");
+  REQUIRE(field(GPRMC, index, 12) == "A");
+
+  /* The NMEA message is not modified. */
+  REQUIRE(GPRMC == GPRMC_COPY);
+}
+
+TEST_CASE("Testing 'buildFieldIndex(...)' with a NMEA message consisting of empty fields", "[buildFieldIndex-02]")
+{
+  std::string const GPRMC = "$GPRMC,,V,,,,,,,,,,N*53\r\n";
+
+  nmea::util::FieldIndex index;
+  nmea::util::buildFieldIndex(GPRMC.c_str(), index);
+
+  REQUIRE(index.num_fields == 13);
+  REQUIRE(field(GPRMC, index,  1) == "");
+  REQUIRE(field(GPRMC, index,  2) == "V");
+  REQUIRE(field(GPRMC, index, 12) == "N");
+}
+
+TEST_CASE("Testing 'buildFieldIndex(...)' with a NMEA message exceeding MAX_FIELDS", "[buildFieldIndex-03]")
+{
+  std::string nmea = "$GPXXX";
+  for (size_t f = 1; f < nmea::util::MAX_FIELDS + 10; f++)
+    nmea += "," + std::to_string(f);
+  nmea += "*00\r\n";
+
+  nmea::util::FieldIndex index;
+  nmea::util::buildFieldIndex(nmea.c_str(), index);
+
+  REQUIRE(index.num_fields == nmea::util::MAX_FIELDS);
+  REQUIRE(field(nmea, index, nmea::util::MAX_FIELDS - 1) == std::to_string(nmea::util::MAX_FIELDS - 1));
+}
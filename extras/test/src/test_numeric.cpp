@@ -0,0 +1,195 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <random>
+#include <vector>
+
+#include <catch.hpp>
+
+#include <nmea/util/numeric.h>
+#include <nmea/util/common.h>
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+/* Numeric fields as found within real world NMEA messages. */
+static std::vector<std::string> const NMEA_NUMBERS =
+{
+  "0", "00", "0.0", "000.0", "077.0", "023.5", "084.5", "27.920", "247.03",
+  "2.4", "454.7", "46.6", "-46.6", "-0.0", "+3.5", "0.93", "1.25", "99.99",
+  "30.868", "38.0060", "37.99474", "01.53452", "59.9999999", "0.000001",
+  "12345.678", "001.5", "05", "12", "0000", ".5", "5.", "-", ".", "",
+  "1.2.3", "7,5", "3.14159265358979",
+};
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+static bool isSameFloat(float const a, float const b)
+{
+  return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+static bool isSameDouble(double const a, double const b)
+{
+  return memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+/* The implementation of parseLatitude prior to replacing atof/atoi. */
+static float parseLatitudeReference(char const * token)
+{
+  char const deg_str[] = {token[0], token[1], '\0'};
+  char min_str[10] = {0};
+  strncpy(min_str, token + 2, sizeof(min_str) - 1);
+
+  float latitude  = atoi(deg_str);
+        latitude += atof(min_str) / 60.0f;
+
+  return latitude;
+}
+
+/* The implementation of parseLongitude prior to replacing atof/atoi. */
+static float parseLongitudeReference(char const * token)
+{
+  char const deg_str[] = {token[0], token[1], token[2], '\0'};
+  char min_str[10] = {0};
+  strncpy(min_str, token + 3, sizeof(min_str) - 1);
+
+  float longitude  = atoi(deg_str);
+        longitude += atof(min_str) / 60.0f;
+
+  return longitude;
+}
+
+static std::string randomDigits(std::mt19937 & rng, size_t const num_digits)
+{
+  std::uniform_int_distribution<int> digit('0', '9');
+  std::string digits;
+  for (size_t d = 0; d < num_digits; d++)
+    digits += static_cast<char>(digit(rng));
+  return digits;
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("'parseFloat(...)' yields exactly the same result as 'atof(...)'", "[parseFloat-01]")
+{
+  for (std::string const & num : NMEA_NUMBERS)
+  {
+    /* Append a field separator to ensure parsing is limited to the field. */
+    std::string const field = num + ",1";
+    INFO("field = \"" << num << "\"");
+    REQUIRE(isSameFloat(nmea::util::parseFloat(field.c_str(), num.length()), static_cast<float>(atof(field.c_str()))));
+  }
+}
+
+TEST_CASE("'parseFloat(...)' and 'toDouble(...)' yield exactly the same result as 'atof(...)' for random numbers", "[parseFloat-02]")
+{
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<size_t> int_digits(0, 5);
+  /* Up to 15 significant digits are converted exactly. */
+  std::uniform_int_distribution<size_t> frac_digits(0, 10);
+  std::bernoulli_distribution is_negative(0.25);
+
+  for (size_t i = 0; i < 100000; i++)
+  {
+    std::string const num = (is_negative(rng) ? "-" : "") + randomDigits(rng, int_digits(rng)) + "." + randomDigits(rng, frac_digits(rng));
+    INFO("field = \"" << num << "\"");
+
+    nmea::util::Decimal const decimal = nmea::util::parseDecimal(num.c_str(), num.length());
+    REQUIRE(isSameFloat (nmea::util::toFloat (decimal), static_cast<float>(atof(num.c_str()))));
+    REQUIRE(isSameDouble(nmea::util::toDouble(decimal), atof(num.c_str())));
+  }
+}
+
+TEST_CASE("'parseInt(...)' yields exactly the same result as 'atoi(...)'", "[parseInt-01]")
+{
+  for (std::string const & num : NMEA_NUMBERS)
+  {
+    std::string const field = num + ",1";
+    INFO("field = \"" << num << "\"");
+    /* atoi has undefined behaviour when overflowing. */
+    if (num.length() < 10)
+      REQUIRE(nmea::util::parseInt(field.c_str(), num.length()) == atoi(field.c_str()));
+  }
+}
+
+TEST_CASE("Testing 'parseDecimal(...)'", "[parseDecimal-01]")
+{
+  nmea::util::Decimal const decimal = nmea::util::parseDecimal("-0123.4500", 10);
+  REQUIRE(decimal.mantissa    == 1234500);
+  REQUIRE(decimal.exponent    == -4);
+  REQUIRE(decimal.is_negative == true);
+}
+
+TEST_CASE("'parseLatitude(...)' and 'parseLongitude(...)' yield exactly the same result as prior to replacing 'atof(...)'", "[parseCoordinate-01]")
+{
+  std::mt19937 rng(42);
+  /* The reference implementation truncates the minutes to 9 characters. */
+  std::uniform_int_distribution<size_t> frac_digits(0, 6);
+
+  for (size_t i = 0; i < 100000; i++)
+  {
+    std::string const lat = randomDigits(rng, 4) + "." + randomDigits(rng, frac_digits(rng));
+    std::string const lon = randomDigits(rng, 5) + "." + randomDigits(rng, frac_digits(rng));
+    INFO("lat = \"" << lat << "\", lon = \"" << lon << "\"");
+
+    REQUIRE(isSameFloat(nmea::util::parseLatitude (lat.c_str(), lat.length()), parseLatitudeReference (lat.c_str())));
+    REQUIRE(isSameFloat(nmea::util::parseLongitude(lon.c_str(), lon.length()), parseLongitudeReference(lon.c_str())));
+  }
+}
+
+TEST_CASE("'parseTime(...)' only reads the milliseconds from within the field", "[parseTime-01]")
+{
+  /* A time without fraction directly followed by the latitude field. */
+  std::string const GPGGA_FIELDS = "123519,4807.038";
+
+  nmea::Time time_utc;
+  nmea::util::parseTime(GPGGA_FIELDS.c_str(), 6, time_utc);
+
+  REQUIRE(time_utc.hour        == 12);
+  REQUIRE(time_utc.minute      == 35);
+  REQUIRE(time_utc.second      == 19);
+  REQUIRE(time_utc.microsecond == 0);
+}
+
+TEST_CASE("Testing 'parseLatitudeE7(...)' and 'parseLongitudeE7(...)'", "[parseCoordinateE7-01]")
+{
+  WHEN("the minutes are exactly representable")
+  {
+    REQUIRE(nmea::util::parseLatitudeE7 ("5001.869",    8) ==  500311500);
+    REQUIRE(nmea::util::parseLongitudeE7("01912.114",   9) ==  192019000);
+  }
+  WHEN("the result needs to be rounded")
+  {
+    REQUIRE(nmea::util::parseLatitudeE7 ("0000.0000005", 12) == 0);
+    REQUIRE(nmea::util::parseLatitudeE7 ("0000.000003",  11) == 1);
+    REQUIRE(nmea::util::parseLongitudeE7("17959.9999999", 13) == 1800000000);
+  }
+  WHEN("the minutes have more digits than relevant for the result")
+  {
+    REQUIRE(nmea::util::parseLatitudeE7("4837.99474123456789", 19) == 486332457);
+  }
+  WHEN("the field is malformed")
+  {
+    REQUIRE(nmea::util::parseLatitudeE7 ("4",          1) == nmea::INVALID_COORDINATE_E7);
+    REQUIRE(nmea::util::parseLatitudeE7 ("4860.000",   8) == nmea::INVALID_COORDINATE_E7);
+    REQUIRE(nmea::util::parseLongitudeE7("99900.000",  9) == nmea::INVALID_COORDINATE_E7);
+  }
+}
@@ -15,64 +15,187 @@
 #include <stdlib.h>
 #include <stdint.h>
 
-#undef max
-#undef min
-#include <functional>
+/* Set to 0 in order to drop the std::function based constructor
+ * and with it the dependency on <functional>, the allocation
+ * free callback interface is available in either case. Must be
+ * set for all translation units alike, i.e. via the build flags.
+ */
+#ifndef NMEA_PARSER_ENABLE_STD_FUNCTION
+#  define NMEA_PARSER_ENABLE_STD_FUNCTION 1
+#endif
+
+#if NMEA_PARSER_ENABLE_STD_FUNCTION
+#  undef max
+#  undef min
+#  include <functional>
+#endif
 
 #include "nmea/Types.h"
+#include "nmea/NmeaParser.h"
+#include "nmea/SkyView.h"
+#include "nmea/Profiling.h"
+#include "nmea/Statistics.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+/* ArduinoNmeaDecoder and the nmea::NmeaDecoder<...> it is based on
+ * are compiled once within ArduinoNmeaParser.cpp while their
+ * layout depends on NMEA_PARSER_ENABLE_STATISTICS,
+ * NMEA_PARSER_ENABLE_PROFILING and NMEA_PARSER_ENABLE_STD_FUNCTION,
+ * which hence have to be set globally via the build flags. Its
+ * constructors take a tag type named after the settings, so that a
+ * sketch defining the macros differently fails to link with an
+ * undefined reference to, e.g.,
+ * ArduinoNmeaDecoder::ArduinoNmeaDecoder(..., nmea::BuildConfig_S0_P0_F1)
+ * rather than silently corrupting memory.
+ */
+#if NMEA_PARSER_ENABLE_STATISTICS
+#  define NMEA_PARSER_BUILD_CONFIG_S S1
+#else
+#  define NMEA_PARSER_BUILD_CONFIG_S S0
+#endif
+
+#if NMEA_PARSER_ENABLE_PROFILING
+#  define NMEA_PARSER_BUILD_CONFIG_P P1
+#else
+#  define NMEA_PARSER_BUILD_CONFIG_P P0
+#endif
+
+#if NMEA_PARSER_ENABLE_STD_FUNCTION
+#  define NMEA_PARSER_BUILD_CONFIG_F F1
+#else
+#  define NMEA_PARSER_BUILD_CONFIG_F F0
+#endif
+
+#define NMEA_PARSER_BUILD_CONFIG_NAME_(s, p, f) BuildConfig_##s##_##p##_##f
+#define NMEA_PARSER_BUILD_CONFIG_NAME(s, p, f)  NMEA_PARSER_BUILD_CONFIG_NAME_(s, p, f)
+#define NMEA_PARSER_BUILD_CONFIG NMEA_PARSER_BUILD_CONFIG_NAME(NMEA_PARSER_BUILD_CONFIG_S, NMEA_PARSER_BUILD_CONFIG_P, NMEA_PARSER_BUILD_CONFIG_F)
+
+namespace nmea
+{
+
+struct NMEA_PARSER_BUILD_CONFIG { };
+typedef NMEA_PARSER_BUILD_CONFIG BuildConfig;
+
+} /* nmea */
 
 /**************************************************************************************
  * TYPEDEF
  **************************************************************************************/
 
+#if NMEA_PARSER_ENABLE_STD_FUNCTION
 typedef std::function<void(nmea::RmcData const)> OnRmcUpdateFunc;
 typedef std::function<void(nmea::GgaData const)> OnGgaUpdateFunc;
+#endif
+
+/* Plain function pointers taking the decoded data by reference
+ * and a user supplied context pointer, e.g. an object pointer.
+ * Invoking them never allocates memory.
+ */
+typedef void (*OnRmcUpdateCallback)(nmea::RmcData const & rmc, void * context);
+typedef void (*OnGgaUpdateCallback)(nmea::GgaData const & gga, void * context);
+typedef void (*OnGsaUpdateCallback)(nmea::GsaData const & gsa, void * context);
+
+/* Callbacks of the early dispatch, see setEarlyDispatch(). */
+typedef void (*OnRmcProvisionalCallback)(nmea::RmcData const & rmc, nmea::Provisional const available, void * context);
+typedef void (*OnGgaProvisionalCallback)(nmea::GgaData const & gga, nmea::Provisional const available, void * context);
+typedef void (*OnVerdictCallback)(nmea::Verdict const verdict, void * context);
 
 /**************************************************************************************
  * CLASS DECLARATION
  **************************************************************************************/
 
-class ArduinoNmeaParser
+/* Compiled once within ArduinoNmeaParser.cpp, see below. */
+extern template class nmea::NmeaDecoder<nmea::Rmc, nmea::Gga, nmea::Gsv, nmea::Gsa>;
+
+/* Decodes RMC, GGA, GSV and GSA messages and notifies the user about
+ * updates, it is independent of the parse buffer size and
+ * therefore shared by all BasicArduinoNmeaParser<...>. Besides
+ * the interface of nmea::NmeaDecoder it provides the accessors and
+ * callbacks of the original ArduinoNmeaParser.
+ */
+class ArduinoNmeaDecoder : public nmea::NmeaDecoder<nmea::Rmc, nmea::Gga, nmea::Gsv, nmea::Gsa>
 {
 
 public:
 
-  ArduinoNmeaParser(OnRmcUpdateFunc on_rmc_update,
-                    OnGgaUpdateFunc on_gga_update);
+#if NMEA_PARSER_ENABLE_STD_FUNCTION
+  /* The context handed to all other callbacks, e.g. the one
+   * registered via setOnGsaUpdate(), is the decoder itself.
+   */
+  ArduinoNmeaDecoder(OnRmcUpdateFunc on_rmc_update,
+                     OnGgaUpdateFunc on_gga_update,
+                     nmea::BuildConfig const = nmea::BuildConfig{});
+#endif
+  ArduinoNmeaDecoder(OnRmcUpdateCallback on_rmc_update,
+                     OnGgaUpdateCallback on_gga_update,
+                     void * context,
+                     nmea::BuildConfig const = nmea::BuildConfig{});
 
 
-  void encode(char const c);
+  inline const nmea::RmcData rmc() const { return data<nmea::Rmc>(); }
+  inline const nmea::GgaData gga() const { return data<nmea::Gga>(); }
+  /* Merged data of all GSA messages, see nmea::GxGSA::merge(). */
+  inline const nmea::GsaData gsa() const { return data<nmea::Gsa>(); }
 
+  /* Invoked with the user supplied context after each GSA message. */
+  inline void setOnGsaUpdate(OnGsaUpdateCallback on_gsa_update) { onUpdate<nmea::Gsa>(on_gsa_update); }
 
-  inline const nmea::RmcData rmc() const { return _rmc; }
-  inline const nmea::GgaData gga() const { return _gga; }
 
+#if NMEA_PARSER_ENABLE_STD_FUNCTION
+private:
 
-  enum class Error { None, Checksum };
+  OnRmcUpdateFunc _on_rmc_update;
+  OnGgaUpdateFunc _on_gga_update;
 
-  inline void  clearerr()       { _error = Error::None; }
-  inline Error error   () const { return _error; }
+  static void onRmcUpdateFunc(nmea::RmcData const & rmc, void * decoder);
+  static void onGgaUpdateFunc(nmea::GgaData const & gga, void * decoder);
+#endif
+};
 
+/* PARSE_BUFFER_SIZE limits the length of accepted NMEA messages
+ * to PARSE_BUFFER_SIZE - 1 characters, e.g. BasicArduinoNmeaParser<128>
+ * accepts proprietary messages exceeding the standard length
+ * of 82 characters.
+ */
+template <size_t PARSE_BUFFER_SIZE>
+class BasicArduinoNmeaParser : public nmea::FramedDecoder<PARSE_BUFFER_SIZE, ArduinoNmeaDecoder>
+{
 
-private:
+public:
 
-  static size_t constexpr NMEA_PARSE_BUFFER_SIZE = 82 + 1; /* Leave space for the '\0' terminator */
+#if NMEA_PARSER_ENABLE_STD_FUNCTION
+  BasicArduinoNmeaParser(OnRmcUpdateFunc on_rmc_update,
+                         OnGgaUpdateFunc on_gga_update)
+  : nmea::FramedDecoder<PARSE_BUFFER_SIZE, ArduinoNmeaDecoder>(on_rmc_update, on_gga_update)
+  { }
+#endif
+  BasicArduinoNmeaParser(OnRmcUpdateCallback on_rmc_update,
+                         OnGgaUpdateCallback on_gga_update,
+                         void * context)
+  : nmea::FramedDecoder<PARSE_BUFFER_SIZE, ArduinoNmeaDecoder>(on_rmc_update, on_gga_update, context)
+  { }
+
+
+  /* Early dispatch of RMC and GGA messages, see
+   * nmea::FramedDecoder::onProvisional().
+   */
+  void setEarlyDispatch(OnRmcProvisionalCallback on_rmc_provisional,
+                        OnGgaProvisionalCallback on_gga_provisional,
+                        OnVerdictCallback on_verdict)
+  {
+    this->template onProvisional<nmea::Rmc>(on_rmc_provisional);
+    this->template onProvisional<nmea::Gga>(on_gga_provisional);
+    this->onVerdict(on_verdict);
+  }
+};
 
-  Error _error;
-  char _parser_buf[NMEA_PARSE_BUFFER_SIZE];
-  size_t _parser_buf_elems;
-  nmea::RmcData _rmc;
-  nmea::GgaData _gga;
-  OnRmcUpdateFunc _on_rmc_update;
-  OnGgaUpdateFunc _on_gga_update;
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
 
-  bool isParseBufferFull();
-  void addToParserBuffer(char const c);
-  void flushParserBuffer();
-  bool isCompleteNmeaMessageInParserBuffer();
-  void terminateParserBuffer();
-  void parseGxRMC();
-  void parseGxGGA();
-};
+typedef BasicArduinoNmeaParser<nmea::DEFAULT_PARSE_BUFFER_SIZE> ArduinoNmeaParser;
 
 #endif /* ARDUINO_MTK3333_NMEA_PARSER_H_ */
@@ -0,0 +1,163 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_BYTE_RING_H_
+#define ARDUINO_NMEA_BYTE_RING_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#undef max
+#undef min
+#include <atomic>
+#include <algorithm>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Lock-free single-producer/single-consumer ring buffer which
+ * decouples the reception of characters, e.g. within an UART
+ * interrupt, from decoding them within task context:
+ *
+ *   void onUartRx() { ring.push(UART->DATA); }
+ *   void loop()     { ring.feed(parser); }
+ *
+ * push() is wait-free and only uses atomic loads and stores,
+ * which are available without locking on all supported cores.
+ * Characters which do not fit into the ring are dropped and
+ * counted as overruns.
+ */
+template <size_t CAPACITY>
+class ByteRing
+{
+
+public:
+
+  static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY needs to be a power of two");
+
+
+  ByteRing()
+  : _buf{0}
+  , _head{0}
+  , _tail{0}
+  , _overruns{0}
+  { }
+
+
+  /* Producer side, returns false if the ring is full. */
+  bool push(uint8_t const c)
+  {
+    size_t const head = _head.load(std::memory_order_relaxed);
+
+    if ((head - _tail.load(std::memory_order_acquire)) == CAPACITY)
+    {
+      countOverruns(1);
+      return false;
+    }
+
+    _buf[head & MASK] = c;
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /* Producer side, e.g. for draining a hardware FIFO at once.
+   * Returns the number of characters which fit into the ring.
+   */
+  size_t push(uint8_t const * buf, size_t const len)
+  {
+    size_t const head = _head.load(std::memory_order_relaxed);
+    size_t const space = CAPACITY - (head - _tail.load(std::memory_order_acquire));
+    size_t const num = std::min(len, space);
+
+    size_t const offset = head & MASK;
+    size_t const first = std::min(num, CAPACITY - offset);
+    memcpy(_buf + offset, buf, first);
+    memcpy(_buf, buf + first, num - first);
+
+    if (num < len)
+      countOverruns(len - num);
+
+    _head.store(head + num, std::memory_order_release);
+    return num;
+  }
+
+  /* Consumer side, hands all buffered characters to 'parser'
+   * in at most two calls to encode() and returns their number.
+   * The characters are only released after encode() returned,
+   * hence they are decoded in place without being copied.
+   */
+  template <typename Parser>
+  size_t feed(Parser & parser)
+  {
+    size_t const tail = _tail.load(std::memory_order_relaxed);
+    size_t const num = _head.load(std::memory_order_acquire) - tail;
+
+    size_t const offset = tail & MASK;
+    size_t const first = std::min(num, CAPACITY - offset);
+    if (first > 0)
+      parser.encode(_buf + offset, first);
+    if (num > first)
+      parser.encode(_buf, num - first);
+
+    _tail.store(tail + num, std::memory_order_release);
+    return num;
+  }
+
+  /* Number of buffered characters, only a snapshot when
+   * called while the other side is active.
+   */
+  inline size_t size() const { return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire); }
+  inline size_t capacity() const { return CAPACITY; }
+
+  /* Number of characters dropped because the ring was full.
+   * The counter wraps around after 2^32 characters.
+   */
+  inline uint32_t overruns() const { return _overruns.load(std::memory_order_relaxed); }
+
+
+private:
+
+  static size_t constexpr MASK = CAPACITY - 1;
+
+  /* Both indices run freely and are only reduced to a position
+   * within _buf when accessing it, so that a full ring can be
+   * told apart from an empty one without wasting a slot.
+   */
+  uint8_t _buf[CAPACITY];
+  std::atomic<size_t> _head;
+  std::atomic<size_t> _tail;
+  std::atomic<uint32_t> _overruns;
+
+  /* Only the producer modifies the counter, a read-modify-write
+   * operation which might require a lock is therefore not needed.
+   */
+  inline void countOverruns(size_t const num)
+  {
+    _overruns.store(_overruns.load(std::memory_order_relaxed) + static_cast<uint32_t>(num), std::memory_order_relaxed);
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_BYTE_RING_H_ */
@@ -0,0 +1,287 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_EVENT_QUEUE_H_
+#define ARDUINO_NMEA_EVENT_QUEUE_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#undef max
+#undef min
+#include <atomic>
+
+#include "Types.h"
+
+/* Dropping the oldest event requires a compare-and-swap on
+ * size_t, which e.g. ARMv6-M (Cortex-M0/M0+, SAMD21) lacks.
+ * Without it OverflowPolicy::DropNewest becomes the default
+ * and OverflowPolicy::DropOldest is rejected at compile time,
+ * rather than linking against libatomic or failing to link.
+ */
+#ifndef NMEA_EVENT_QUEUE_HAS_CAS
+#  if !defined(__GNUC__) || (__SIZEOF_SIZE_T__ == 4 && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4)) || (__SIZEOF_SIZE_T__ == 8 && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8))
+#    define NMEA_EVENT_QUEUE_HAS_CAS 1
+#  else
+#    define NMEA_EVENT_QUEUE_HAS_CAS 0
+#  endif
+#endif
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+enum class EventType { Rmc, Gga, Gsa };
+
+/* Decoded NMEA message, 'type' selects the valid member. */
+typedef struct
+{
+  EventType type;
+  union
+  {
+    RmcData rmc;
+    GgaData gga;
+    GsaData gsa;
+  };
+} Event;
+
+enum class OverflowPolicy { DropOldest, DropNewest };
+
+#if NMEA_EVENT_QUEUE_HAS_CAS
+static OverflowPolicy constexpr DEFAULT_OVERFLOW_POLICY = OverflowPolicy::DropOldest;
+#else
+static OverflowPolicy constexpr DEFAULT_OVERFLOW_POLICY = OverflowPolicy::DropNewest;
+#endif
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Lock-free single-producer/single-consumer queue of decoded
+ * NMEA messages, allowing a consumer task to process them at
+ * its own pace without stalling encode(). The queue is filled
+ * via the update callbacks of the parsers:
+ *
+ *   nmea::EventQueue<8> queue;
+ *   ArduinoNmeaParser parser(nmea::EventQueue<8>::onUpdate<nmea::RmcData>,
+ *                            nmea::EventQueue<8>::onUpdate<nmea::GgaData>,
+ *                            &queue);
+ *   parser.setOnGsaUpdate(nmea::EventQueue<8>::onUpdate<nmea::GsaData>);
+ *
+ * The sky view is not queued since a nmea::SkyView is about ten
+ * times the size of the other events and would enlarge every
+ * pool slot accordingly. nmea::SkyViewAssembler publishes it at
+ * most once per epoch, e.g. into a nmea::Snapshot<nmea::SkyView>
+ * read by the consumer.
+ *
+ * All events are stored within a preallocated pool, the queue
+ * itself only passes the indices of the pool slots. This way a
+ * full queue can drop its oldest event while the consumer is
+ * copying another one, without either side ever waiting.
+ * Both sides then race for the oldest event via compare-and-swap,
+ * with OverflowPolicy::DropNewest only the consumer advances
+ * _tail and plain loads and stores suffice.
+ */
+template <size_t CAPACITY, OverflowPolicy POLICY = DEFAULT_OVERFLOW_POLICY>
+class EventQueue
+{
+
+public:
+
+  static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY needs to be a power of two");
+  static_assert(CAPACITY <= 128, "Pool slots are addressed via uint8_t");
+  static_assert(POLICY != OverflowPolicy::DropOldest || NMEA_EVENT_QUEUE_HAS_CAS, "OverflowPolicy::DropOldest requires compare-and-swap, use OverflowPolicy::DropNewest on this target");
+
+
+  EventQueue()
+  : _head{0}
+  , _tail{0}
+  , _free_head{POOL_SIZE - 1}
+  , _free_tail{0}
+  , _write_slot{0}
+  , _spare_slot{NO_SLOT}
+  , _overflows{0}
+  {
+    /* The producer starts out owning slot 0, all others are free. */
+    for (uint8_t s = 1; s < POOL_SIZE; s++)
+      _free[s - 1].store(s, std::memory_order_relaxed);
+  }
+
+
+  /* Producer side, returns false if the event has been dropped. */
+  inline bool push(RmcData const & rmc) { Event & e = _pool[_write_slot]; e.type = EventType::Rmc; e.rmc = rmc; return commit(); }
+  inline bool push(GgaData const & gga) { Event & e = _pool[_write_slot]; e.type = EventType::Gga; e.gga = gga; return commit(); }
+  inline bool push(GsaData const & gsa) { Event & e = _pool[_write_slot]; e.type = EventType::Gsa; e.gsa = gsa; return commit(); }
+
+  /* Matches the update callbacks of ArduinoNmeaParser and
+   * NmeaParser, 'queue' is the user supplied context.
+   */
+  template <typename Data>
+  static void onUpdate(Data const & data, void * queue) { static_cast<EventQueue *>(queue)->push(data); }
+
+  /* Consumer side, copies the oldest event to 'event' and
+   * returns false if the queue is empty.
+   */
+  bool pop(Event & event)
+  {
+    for (;;)
+    {
+      size_t const tail = _tail.load(std::memory_order_acquire);
+      if (tail == _head.load(std::memory_order_acquire))
+        return false;
+
+      /* Claim the oldest event, this fails if the producer
+       * has dropped it in the meantime.
+       */
+      uint8_t const slot = _ring[tail & MASK].load(std::memory_order_relaxed);
+      if (!claim(tail, Policy<POLICY>()))
+        continue;
+
+      event = _pool[slot];
+      releaseSlot(slot);
+      return true;
+    }
+  }
+
+  /* Number of queued events, only a snapshot when called
+   * while the other side is active.
+   */
+  inline size_t size() const { return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire); }
+  inline size_t capacity() const { return CAPACITY; }
+
+  /* Number of events dropped because the queue was full. */
+  inline uint32_t overflows() const { return _overflows.load(std::memory_order_relaxed); }
+
+
+private:
+
+  /* CAPACITY queued events, one slot being written by the
+   * producer and one slot being copied by the consumer.
+   */
+  static size_t constexpr POOL_SIZE = CAPACITY + 2;
+  static size_t constexpr MASK = CAPACITY - 1;
+  static uint8_t constexpr NO_SLOT = 0xFF;
+
+  Event _pool[POOL_SIZE];
+  /* Pool slots of the queued events, from _tail to _head. */
+  std::atomic<uint8_t> _ring[CAPACITY];
+  std::atomic<size_t> _head;
+  std::atomic<size_t> _tail;
+  /* Pool slots returned by the consumer, holds at most
+   * POOL_SIZE - 1 entries since the producer always owns
+   * _write_slot.
+   */
+  std::atomic<uint8_t> _free[POOL_SIZE];
+  std::atomic<size_t> _free_head;
+  std::atomic<size_t> _free_tail;
+  /* Only accessed by the producer. */
+  uint8_t _write_slot;
+  uint8_t _spare_slot;
+  std::atomic<uint32_t> _overflows;
+
+  /* Only the producer modifies the counter, see ByteRing. */
+  inline void countOverflow() { _overflows.store(_overflows.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
+  static inline size_t nextFree(size_t const idx) { return (idx + 1 == POOL_SIZE) ? 0 : (idx + 1); }
+
+  /* Advances _tail past the event at 'tail', returns false if
+   * the other side has done so first. Overloaded instead of
+   * branching on POLICY so that DropNewest queues never
+   * instantiate the compare-and-swap.
+   */
+  template <OverflowPolicy P> struct Policy { };
+
+  inline bool claim(size_t tail, Policy<OverflowPolicy::DropOldest>)
+  {
+    return _tail.compare_exchange_strong(tail, tail + 1, std::memory_order_acq_rel);
+  }
+  inline bool claim(size_t const tail, Policy<OverflowPolicy::DropNewest>)
+  {
+    /* Only the consumer ever advances _tail. */
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool commit()
+  {
+    size_t const head = _head.load(std::memory_order_relaxed);
+    size_t tail = _tail.load(std::memory_order_acquire);
+
+    if ((head - tail) == CAPACITY)
+    {
+      if (POLICY == OverflowPolicy::DropNewest)
+      {
+        countOverflow();
+        return false;
+      }
+
+      /* Take over the slot of the oldest event unless the
+       * consumer has claimed it first, in both cases there
+       * is room for the new event afterwards.
+       */
+      uint8_t const oldest = _ring[tail & MASK].load(std::memory_order_relaxed);
+      if (claim(tail, Policy<POLICY>()))
+      {
+        _spare_slot = oldest;
+        countOverflow();
+      }
+    }
+
+    _ring[head & MASK].store(_write_slot, std::memory_order_relaxed);
+    _head.store(head + 1, std::memory_order_release);
+
+    _write_slot = acquireSlot();
+    return true;
+  }
+
+  uint8_t acquireSlot()
+  {
+    if (_spare_slot != NO_SLOT)
+    {
+      uint8_t const slot = _spare_slot;
+      _spare_slot = NO_SLOT;
+      return slot;
+    }
+
+    /* The free list is never empty at this point: at most
+     * CAPACITY slots are queued and the consumer holds at most
+     * one slot, see POOL_SIZE. Loading _free_head synchronizes
+     * with the consumer having finished copying the slot.
+     */
+    _free_head.load(std::memory_order_acquire);
+    size_t const free_tail = _free_tail.load(std::memory_order_relaxed);
+    uint8_t const slot = _free[free_tail].load(std::memory_order_relaxed);
+    _free_tail.store(nextFree(free_tail), std::memory_order_release);
+    return slot;
+  }
+
+  void releaseSlot(uint8_t const slot)
+  {
+    size_t const free_head = _free_head.load(std::memory_order_relaxed);
+    _free[free_head].store(slot, std::memory_order_relaxed);
+    _free_head.store(nextFree(free_head), std::memory_order_release);
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_EVENT_QUEUE_H_ */
@@ -13,17 +13,13 @@
 
 #include <string.h>
 
-#ifdef ARDUINO_ARCH_ESP32
-#  include <stdlib_noniso.h>
-#endif
+#undef max
+#undef min
+#include <algorithm>
 
-#ifdef ARDUINO_ARCH_RENESAS
-extern "C" char * _EXFUN(strsep,(char **, const char *));
-#endif
-
-#include "util/gga.h"
 #include "util/common.h"
-#include "util/checksum.h"
+#include "util/numeric.h"
+#include "util/dispatch.h"
 
 /**************************************************************************************
  * NAMESPACE
@@ -36,118 +32,152 @@ namespace nmea
  * PUBLIC MEMBER FUNCTIONS
  **************************************************************************************/
 
-void GxGGA::parse(char * gxgga, GgaData & data)
+void GxGGA::parse(char const * gxgga, GgaData & data)
+{
+  util::FieldIndex index;
+  util::buildFieldIndex(gxgga, index);
+
+  char const * message_id = gxgga + index.field[0].offset;
+  parse(gxgga, index, util::parseTalker(message_id, index.field[0].length), data);
+}
+
+void GxGGA::parse(char const * gxgga, util::FieldIndex const & index, GgaSource const source, GgaData & data)
 {
   ParserState state = ParserState::MessageId;
 
-  /* Replace the '*' sign denoting the start of the checksum
-   * with a ',' in order to be able to tokenize all elements
-   * including the one before the checksum.
+  /* Each field of the NMEA message is directly accessed
+   * via the field index, the message itself is neither
+   * modified nor tokenized by inserting '\0' terminators.
    */
-  *strchr(gxgga, '*') = ',';
+  for (size_t f = 0; (f < index.num_fields) && (state != ParserState::Done); f++)
+    state = handle(state, gxgga + index.field[f].offset, index.field[f].length, source, data);
+}
 
-  for (char * token = strsep(&gxgga, ",");
-       token != nullptr;
-       token = strsep(&gxgga, ","))
-  {
-    ParserState next_state = state;
-
-    switch(state)
-    {
-    case ParserState::MessageId:                     next_state = handle_MessageId                    (token, data.source);             break;
-    case ParserState::UTCPositionFix:                next_state = handle_UTCPositionFix               (token, data.time_utc);           break;
-    case ParserState::LatitudeVal:                   next_state = handle_LatitudeVal                  (token, data.latitude);           break;
-    case ParserState::LatitudeNS:                    next_state = handle_LatitudeNS                   (token, data.latitude);           break;
-    case ParserState::LongitudeVal:                  next_state = handle_LongitudeVal                 (token, data.longitude);          break;
-    case ParserState::LongitudeEW:                   next_state = handle_LongitudeEW                  (token, data.longitude);          break;
-    case ParserState::FixQuality:                    next_state = handle_FixQuality                   (token, data.fix_quality);        break;
-    case ParserState::NumberSatellites:              next_state = handle_NumberSatellites             (token, data.num_satellites);     break;
-    case ParserState::HorizontalDilutionOfPrecision: next_state = handle_HorizontalDilutionOfPrecision(token, data.hdop);               break;
-    case ParserState::Altitude:                      next_state = handle_Altitude                     (token, data.altitude);           break;
-    case ParserState::AltitudeUnit:                  next_state = handle_AltitudeUnit                 (token, data.altitude);           break;
-    case ParserState::GeoidalSeparation:             next_state = handle_GeoidalSeparation            (token, data.geoidal_separation); break;
-    case ParserState::GeoidalSeparationUnit:         next_state = handle_GeoidalSeparationUnit        (token, data.geoidal_separation); break;
-    case ParserState::DGPSAge:                       next_state = handle_DGPSAge                      (token, data.dgps_age);           break;
-    case ParserState::DGPSId:                        next_state = handle_DGPSId                       (token, data.dgps_id);            break;
-    case ParserState::Checksum:                      next_state = handle_Checksum                     (token);                          break;
-    case ParserState::Done:                                                                                                             break;
-    };
-
-    state = next_state;
-  }
+void GxGGA::parseField(size_t const field, char const * token, size_t const token_len, GgaSource const source, GgaData & data)
+{
+  static_assert(TIME_FIELD     == static_cast<size_t>(ParserState::UTCPositionFix), "TIME_FIELD needs to denote the time field");
+  static_assert(POSITION_FIELD == static_cast<size_t>(ParserState::LongitudeEW),    "POSITION_FIELD needs to denote the last field of the position");
+
+  /* Each field is handled by its own state, the state
+   * machine advances by exactly one state per field.
+   */
+  if (field < static_cast<size_t>(ParserState::Done))
+    handle(static_cast<ParserState>(field), token, token_len, source, data);
 }
 
 /**************************************************************************************
  * PRIVATE MEMBER FUNCTIONS
  **************************************************************************************/
 
-GxGGA::ParserState GxGGA::handle_MessageId(char const * token, GgaSource & source)
+GxGGA::ParserState GxGGA::handle(ParserState const state, char const * token, size_t const token_len, GgaSource const source, GgaData & data)
+{
+  ParserState next_state = state;
+
+  switch(state)
+  {
+  case ParserState::MessageId:                     next_state = handle_MessageId                    (source, data.source);                                 break;
+  case ParserState::UTCPositionFix:                next_state = handle_UTCPositionFix               (token, token_len, data.time_utc);                     break;
+  case ParserState::LatitudeVal:                   next_state = handle_LatitudeVal                  (token, token_len, data.latitude, data.latitude_e7);   break;
+  case ParserState::LatitudeNS:                    next_state = handle_LatitudeNS                   (token, token_len, data.latitude, data.latitude_e7);   break;
+  case ParserState::LongitudeVal:                  next_state = handle_LongitudeVal                 (token, token_len, data.longitude, data.longitude_e7); break;
+  case ParserState::LongitudeEW:                   next_state = handle_LongitudeEW                  (token, token_len, data.longitude, data.longitude_e7); break;
+  case ParserState::FixQuality:                    next_state = handle_FixQuality                   (token, token_len, data.fix_quality);                  break;
+  case ParserState::NumberSatellites:              next_state = handle_NumberSatellites             (token, token_len, data.num_satellites);               break;
+  case ParserState::HorizontalDilutionOfPrecision: next_state = handle_HorizontalDilutionOfPrecision(token, token_len, data.hdop);                         break;
+  case ParserState::Altitude:                      next_state = handle_Altitude                     (token, token_len, data.altitude);                     break;
+  case ParserState::AltitudeUnit:                  next_state = handle_AltitudeUnit                 (token, token_len, data.altitude);                     break;
+  case ParserState::GeoidalSeparation:             next_state = handle_GeoidalSeparation            (token, token_len, data.geoidal_separation);           break;
+  case ParserState::GeoidalSeparationUnit:         next_state = handle_GeoidalSeparationUnit        (token, token_len, data.geoidal_separation);           break;
+  case ParserState::DGPSAge:                       next_state = handle_DGPSAge                      (token, token_len, data.dgps_age);                     break;
+  case ParserState::DGPSId:                        next_state = handle_DGPSId                       (token, token_len, data.dgps_id);                      break;
+  case ParserState::Done:                                                                                                                                  break;
+  };
+
+  return next_state;
+}
+
+GxGGA::ParserState GxGGA::handle_MessageId(GgaSource const talker, GgaSource & source)
 {
-  if (util::gga_isGPGGA(token))
-    source = GgaSource::GPS;
-  else if (util::gga_isGLGGA(token))
-    source = GgaSource::GLONASS;
-  else if (util::gga_isGAGGA(token))
-    source = GgaSource::Galileo;
-  else if (util::gga_isGNGGA(token))
-    source = GgaSource::GNSS;
-  else if (util::rmc_isBDGGA(token))
-    source = GgaSource::BDS;
+  /* The talker id has already been decoded when
+   * dispatching the NMEA message to this decoder.
+   */
+  if (talker != GgaSource::Unknown)
+    source = talker;
 
   return ParserState::UTCPositionFix;
 }
 
-GxGGA::ParserState GxGGA::handle_UTCPositionFix(char const * token, Time & time_utc)
+GxGGA::ParserState GxGGA::handle_UTCPositionFix(char const * token, size_t const token_len, Time & time_utc)
 {
-  if (strlen(token))
-    util::parseTime(token, time_utc);
+  if (token_len)
+    util::parseTime(token, token_len, time_utc);
   else
     time_utc = INVALID_TIME;
 
   return ParserState::LatitudeVal;
 }
 
-GxGGA::ParserState GxGGA::handle_LatitudeVal(char const * token, float & latitude)
+GxGGA::ParserState GxGGA::handle_LatitudeVal(char const * token, size_t const token_len, float & latitude, int32_t & latitude_e7)
 {
-  if (strlen(token))
-    latitude = util::parseLatitude(token);
+  if (token_len)
+  {
+    latitude    = util::parseLatitude  (token, token_len);
+    latitude_e7 = util::parseLatitudeE7(token, token_len);
+  }
   else
-    latitude = NAN;
+  {
+    latitude    = NAN;
+    latitude_e7 = INVALID_COORDINATE_E7;
+  }
 
   return ParserState::LatitudeNS;
 }
 
-GxGGA::ParserState GxGGA::handle_LatitudeNS(char const * token, float & latitude)
+GxGGA::ParserState GxGGA::handle_LatitudeNS(char const * token, size_t const token_len, float & latitude, int32_t & latitude_e7)
 {
-  if (strlen(token) > 0  && !strncmp(token, "S", 1))
+  if (token_len > 0 && (token[0] == 'S'))
+  {
     latitude *= (-1.0f);
+    if (latitude_e7 != INVALID_COORDINATE_E7)
+      latitude_e7 = -latitude_e7;
+  }
 
   return ParserState::LongitudeVal;
 }
 
-GxGGA::ParserState GxGGA::handle_LongitudeVal(char const * token, float & longitude)
+GxGGA::ParserState GxGGA::handle_LongitudeVal(char const * token, size_t const token_len, float & longitude, int32_t & longitude_e7)
 {
-  if (strlen(token))
-    longitude = util::parseLongitude(token);
+  if (token_len)
+  {
+    longitude    = util::parseLongitude  (token, token_len);
+    longitude_e7 = util::parseLongitudeE7(token, token_len);
+  }
   else
-    longitude = NAN;
+  {
+    longitude    = NAN;
+    longitude_e7 = INVALID_COORDINATE_E7;
+  }
 
   return ParserState::LongitudeEW;
 }
 
-GxGGA::ParserState GxGGA::handle_LongitudeEW(char const * token, float & longitude)
+GxGGA::ParserState GxGGA::handle_LongitudeEW(char const * token, size_t const token_len, float & longitude, int32_t & longitude_e7)
 {
-  if (strlen(token) > 0 && !strncmp(token, "W", 1))
+  if (token_len > 0 && (token[0] == 'W'))
+  {
     longitude *= (-1.0f);
+    if (longitude_e7 != INVALID_COORDINATE_E7)
+      longitude_e7 = -longitude_e7;
+  }
 
   return ParserState::FixQuality;
 }
 
-GxGGA::ParserState GxGGA::handle_FixQuality(char const * token, FixQuality & fix_quality)
+GxGGA::ParserState GxGGA::handle_FixQuality(char const * token, size_t const token_len, FixQuality & fix_quality)
 {
-  if      (strlen(token) > 0 && !strncmp(token, "1", 1))
+  if      (token_len > 0 && (token[0] == '1'))
     fix_quality = FixQuality::GPS_Fix;
-  else if (strlen(token) > 0 && !strncmp(token, "2", 1))
+  else if (token_len > 0 && (token[0] == '2'))
     fix_quality = FixQuality::DGPS_Fix;
   else
     fix_quality = FixQuality::Invalid;
@@ -155,84 +185,77 @@ GxGGA::ParserState GxGGA::handle_FixQuality(char const * token, FixQuality & fix
   return ParserState::NumberSatellites;
 }
 
-GxGGA::ParserState GxGGA::handle_NumberSatellites(char const * token, int & num_satellites)
+GxGGA::ParserState GxGGA::handle_NumberSatellites(char const * token, size_t const token_len, int & num_satellites)
 {
-  if (strlen(token))
-    num_satellites = atoi(token);
+  if (token_len)
+    num_satellites = util::parseInt(token, token_len);
   else
     num_satellites = -1;
 
   return ParserState::HorizontalDilutionOfPrecision;
 }
 
-GxGGA::ParserState GxGGA::handle_HorizontalDilutionOfPrecision(char const * token, float & hdop)
+GxGGA::ParserState GxGGA::handle_HorizontalDilutionOfPrecision(char const * token, size_t const token_len, float & hdop)
 {
-  if (strlen(token))
-    hdop = atof(token);
+  if (token_len)
+    hdop = util::parseFloat(token, token_len);
   else
     hdop = NAN;
 
   return ParserState::Altitude;
 }
 
-GxGGA::ParserState GxGGA::handle_Altitude(char const * token, float & altitude)
+GxGGA::ParserState GxGGA::handle_Altitude(char const * token, size_t const token_len, float & altitude)
 {
-  if (strlen(token))
-    altitude = atof(token);
+  if (token_len)
+    altitude = util::parseFloat(token, token_len);
   else
     altitude = NAN;
 
   return ParserState::AltitudeUnit;
 }
 
-GxGGA::ParserState GxGGA::handle_AltitudeUnit(char const * token, float & altitude)
+GxGGA::ParserState GxGGA::handle_AltitudeUnit(char const * /* token */, size_t const token_len, float & altitude)
 {
-  if (!strlen(token))
+  if (!token_len)
     altitude = NAN;
 
   return ParserState::GeoidalSeparation;
 }
 
-GxGGA::ParserState GxGGA::handle_GeoidalSeparation(char const * token, float & geoidal_separation)
+GxGGA::ParserState GxGGA::handle_GeoidalSeparation(char const * token, size_t const token_len, float & geoidal_separation)
 {
-  if (strlen(token))
-    geoidal_separation = atof(token);
+  if (token_len)
+    geoidal_separation = util::parseFloat(token, token_len);
   else
     geoidal_separation = NAN;
 
   return ParserState::GeoidalSeparationUnit;
 }
 
-GxGGA::ParserState GxGGA::handle_GeoidalSeparationUnit(char const * token, float & geoidal_separation)
+GxGGA::ParserState GxGGA::handle_GeoidalSeparationUnit(char const * /* token */, size_t const token_len, float & geoidal_separation)
 {
-  if (!strlen(token))
+  if (!token_len)
     geoidal_separation = NAN;
 
   return ParserState::DGPSAge;
 }
 
-GxGGA::ParserState GxGGA::handle_DGPSAge(char const * token, int & dgps_age)
+GxGGA::ParserState GxGGA::handle_DGPSAge(char const * token, size_t const token_len, int & dgps_age)
 {
-  if (strlen(token))
-    dgps_age = atoi(token);
+  if (token_len)
+    dgps_age = util::parseInt(token, token_len);
   else
     dgps_age = -1;
 
   return ParserState::DGPSId;
 }
 
-GxGGA::ParserState GxGGA::handle_DGPSId(char const * token, char * dgps_id)
+GxGGA::ParserState GxGGA::handle_DGPSId(char const * token, size_t const token_len, char * dgps_id)
 {
-  if (strlen(token))
-    memcpy(dgps_id, token, sizeof(GgaData::dgps_id));
-  else
-    memset(dgps_id, 0, sizeof(GgaData::dgps_id));
-
-  return ParserState::Checksum;
-}
+  memset(dgps_id, 0, sizeof(GgaData::dgps_id));
+  memcpy(dgps_id, token, std::min(token_len, sizeof(GgaData::dgps_id)));
 
-GxGGA::ParserState GxGGA::handle_Checksum(char const * /* token */)
-{
   return ParserState::Done;
 }
 
@@ -15,6 +15,8 @@
 #include <stdint.h>
 
 #include "Types.h"
+#include "util/field.h"
+#include "util/dispatch.h"
 
 /**************************************************************************************
  * NAMESPACE
@@ -32,7 +34,21 @@ class GxGGA
 
 public:
 
-  static void parse(char * gxgga, GgaData & data);
+  static void parse(char const * gxgga, GgaData & data);
+  static void parse(char const * gxgga, util::FieldIndex const & index, GgaSource const source, GgaData & data);
+
+  /* Decodes the single field 'field' of a GGA message, 0 being
+   * the message id, e.g. while the message is still received.
+   * Decoding all fields in ascending order into the same 'data'
+   * yields the same result as parse().
+   */
+  static void parseField(size_t const field, char const * token, size_t const token_len, GgaSource const source, GgaData & data);
+
+  /* The time is complete after decoding field TIME_FIELD,
+   * latitude and longitude after decoding POSITION_FIELD.
+   */
+  static size_t constexpr TIME_FIELD     = 1;
+  static size_t constexpr POSITION_FIELD = 5;
 
 private:
 
@@ -56,26 +72,49 @@ private:
     GeoidalSeparationUnit,
     DGPSAge,
     DGPSId,
-    Checksum,
     Done
   };
 
-  static ParserState handle_MessageId                    (char const * token, GgaSource & source);
-  static ParserState handle_UTCPositionFix               (char const * token, Time & time_utc);
-  static ParserState handle_LatitudeVal                  (char const * token, float & latitude);
-  static ParserState handle_LatitudeNS                   (char const * token, float & latitude);
-  static ParserState handle_LongitudeVal                 (char const * token, float & longitude);
-  static ParserState handle_LongitudeEW                  (char const * token, float & longitude);
-  static ParserState handle_FixQuality                   (char const * token, FixQuality & fix_quality);
-  static ParserState handle_NumberSatellites             (char const * token, int & num_satellites);
-  static ParserState handle_HorizontalDilutionOfPrecision(char const * token, float & hdop);
-  static ParserState handle_Altitude                     (char const * token, float & altitude);
-  static ParserState handle_AltitudeUnit                 (char const * token, float & altitude);
-  static ParserState handle_GeoidalSeparation            (char const * token, float & geoidal_separation);
-  static ParserState handle_GeoidalSeparationUnit        (char const * token, float & geoidal_separation);
-  static ParserState handle_DGPSAge                      (char const * token, int & dgps_age);
-  static ParserState handle_DGPSId                       (char const * token, char * dgps_id);
-  static ParserState handle_Checksum                     (char const * token);
+  static ParserState handle(ParserState const state, char const * token, size_t const token_len, GgaSource const source, GgaData & data);
+
+  static ParserState handle_MessageId                    (GgaSource const talker, GgaSource & source);
+  static ParserState handle_UTCPositionFix               (char const * token, size_t const token_len, Time & time_utc);
+  static ParserState handle_LatitudeVal                  (char const * token, size_t const token_len, float & latitude, int32_t & latitude_e7);
+  static ParserState handle_LatitudeNS                   (char const * token, size_t const token_len, float & latitude, int32_t & latitude_e7);
+  static ParserState handle_LongitudeVal                 (char const * token, size_t const token_len, float & longitude, int32_t & longitude_e7);
+  static ParserState handle_LongitudeEW                  (char const * token, size_t const token_len, float & longitude, int32_t & longitude_e7);
+  static ParserState handle_FixQuality                   (char const * token, size_t const token_len, FixQuality & fix_quality);
+  static ParserState handle_NumberSatellites             (char const * token, size_t const token_len, int & num_satellites);
+  static ParserState handle_HorizontalDilutionOfPrecision(char const * token, size_t const token_len, float & hdop);
+  static ParserState handle_Altitude                     (char const * token, size_t const token_len, float & altitude);
+  static ParserState handle_AltitudeUnit                 (char const * token, size_t const token_len, float & altitude);
+  static ParserState handle_GeoidalSeparation            (char const * token, size_t const token_len, float & geoidal_separation);
+  static ParserState handle_GeoidalSeparationUnit        (char const * token, size_t const token_len, float & geoidal_separation);
+  static ParserState handle_DGPSAge                      (char const * token, size_t const token_len, int & dgps_age);
+  static ParserState handle_DGPSId                       (char const * token, size_t const token_len, char * dgps_id);
+};
+
+/* Describes the GGA message for the compile time sentence
+ * selection of nmea::NmeaParser, e.g. NmeaParser<Rmc, Gga>.
+ */
+class Gga
+{
+
+public:
+
+  typedef GgaData Data;
+
+  static constexpr util::Formatter formatter() { return util::toFormatter('G', 'G', 'A'); }
+  static Data invalid() { return INVALID_GGA; }
+  static void parse(char const * msg, util::FieldIndex const & index, GgaSource const source, Data & data) { GxGGA::parse(msg, index, source, data); }
+  static void parseField(size_t const field, char const * token, size_t const token_len, GgaSource const source, Data & data) { GxGGA::parseField(field, token, token_len, source, data); }
+
+  /* Decoding starts out from the previously decoded GGA data. */
+  static void begin (Data const & latest, Data & data) { data = latest; }
+  static void commit(Data const & data, Data & latest) { latest = data; }
+
+  static size_t constexpr TIME_FIELD     = GxGGA::TIME_FIELD;
+  static size_t constexpr POSITION_FIELD = GxGGA::POSITION_FIELD;
 };
 
 /**************************************************************************************
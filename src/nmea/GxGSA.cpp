@@ -0,0 +1,206 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "GxGSA.h"
+
+#include "util/numeric.h"
+#include "util/dispatch.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * INTERNAL FUNCTION DEFINITION
+ **************************************************************************************/
+
+/* Constellation of a satellite listed within a GNGSA message
+ * lacking the system id, derived from the legacy numbering.
+ */
+static Constellation toLegacyConstellation(int const id)
+{
+  if (id >=  65 && id <=  96) return Constellation::GLONASS;
+  if (id >= 193 && id <= 202) return Constellation::QZSS;
+  if (id >= 301 && id <= 336) return Constellation::Galileo;
+  if (id >= 401 && id <= 463) return Constellation::BDS;
+  return Constellation::GPS;
+}
+
+static bool toSystemConstellation(int const system_id, Constellation & constellation)
+{
+  switch (system_id)
+  {
+  case 1:  constellation = Constellation::GPS;     return true;
+  case 2:  constellation = Constellation::GLONASS; return true;
+  case 3:  constellation = Constellation::Galileo; return true;
+  case 4:  constellation = Constellation::BDS;     return true;
+  case 5:  constellation = Constellation::QZSS;    return true;
+  default:                                         return false;
+  }
+}
+
+/**************************************************************************************
+ * PUBLIC MEMBER FUNCTIONS
+ **************************************************************************************/
+
+void GxGSA::parse(char const * gxgsa, GsaData & data)
+{
+  util::FieldIndex index;
+  util::buildFieldIndex(gxgsa, index);
+
+  char const * message_id = gxgsa + index.field[0].offset;
+  parse(gxgsa, index, util::parseTalker(message_id, index.field[0].length), data);
+}
+
+void GxGSA::parse(char const * gxgsa, util::FieldIndex const & index, GsaSource const source, GsaData & data)
+{
+  for (size_t f = 0; f < index.num_fields; f++)
+    parseField(f, gxgsa + index.field[f].offset, index.field[f].length, source, data);
+}
+
+void GxGSA::parseField(size_t const field, char const * token, size_t const token_len, GsaSource const source, GsaData & data)
+{
+  Field const f = static_cast<Field>(field);
+
+  switch (f)
+  {
+  case Field::MessageId:                     handle_MessageId    (source, data);                      break;
+  case Field::SelectionMode:                 handle_SelectionMode(token, token_len, data.is_automatic); break;
+  case Field::FixMode:                       handle_FixMode      (token, token_len, data.fix_type);     break;
+  case Field::PositionDilutionOfPrecision:   handle_Dilution     (token, token_len, data.pdop);         break;
+  case Field::HorizontalDilutionOfPrecision: handle_Dilution     (token, token_len, data.hdop);         break;
+  case Field::VerticalDilutionOfPrecision:   handle_Dilution     (token, token_len, data.vdop);         break;
+  case Field::SystemId:                      handle_SystemId     (token, token_len, data);              break;
+  default:
+    if (f >= Field::FirstSatelliteId && f <= Field::LastSatelliteId)
+      handle_SatelliteId(token, token_len, data);
+    break;
+  }
+}
+
+void GxGSA::merge(GsaData const & gsa, GsaData & latest)
+{
+  /* Either the system id or the talker denote the constellation,
+   * otherwise all constellations with satellites listed within
+   * 'gsa' are covered, or all of them if none is listed at all.
+   */
+  bool covered[NUM_CONSTELLATIONS] = {false};
+  Constellation constellation;
+
+  if (gsa.system_id >= 0)
+  {
+    if (toSystemConstellation(gsa.system_id, constellation))
+      covered[static_cast<size_t>(constellation)] = true;
+  }
+  else if (toConstellation(gsa.source, constellation))
+    covered[static_cast<size_t>(constellation)] = true;
+  else
+  {
+    bool const is_empty = (numActive(gsa) == 0);
+    for (size_t c = 0; c < NUM_CONSTELLATIONS; c++)
+      covered[c] = is_empty || (gsa.active[c] != 0);
+  }
+
+  uint64_t active[NUM_CONSTELLATIONS];
+  for (size_t c = 0; c < NUM_CONSTELLATIONS; c++)
+    active[c] = covered[c] ? gsa.active[c] : latest.active[c];
+
+  latest = gsa;
+  for (size_t c = 0; c < NUM_CONSTELLATIONS; c++)
+    latest.active[c] = active[c];
+}
+
+/**************************************************************************************
+ * PRIVATE MEMBER FUNCTIONS
+ **************************************************************************************/
+
+void GxGSA::handle_MessageId(GsaSource const talker, GsaData & data)
+{
+  data = INVALID_GSA;
+  data.source = talker;
+}
+
+void GxGSA::handle_SelectionMode(char const * token, size_t const token_len, bool & is_automatic)
+{
+  is_automatic = (token_len > 0) && (token[0] == 'A');
+}
+
+void GxGSA::handle_FixMode(char const * token, size_t const token_len, FixType & fix_type)
+{
+  if      (token_len > 0 && (token[0] == '1'))
+    fix_type = FixType::NoFix;
+  else if (token_len > 0 && (token[0] == '2'))
+    fix_type = FixType::Fix2D;
+  else if (token_len > 0 && (token[0] == '3'))
+    fix_type = FixType::Fix3D;
+  else
+    fix_type = FixType::Invalid;
+}
+
+void GxGSA::handle_SatelliteId(char const * token, size_t const token_len, GsaData & data)
+{
+  if (!token_len)
+    return;
+
+  int const id = util::parseInt(token, token_len);
+  int const number = toSatelliteNumber(id);
+  if (number == 0)
+    return;
+
+  /* GNGSA messages are resolved via the numbering for now and
+   * corrected once the system id arrives, see handle_SystemId().
+   */
+  Constellation constellation;
+  if (!toConstellation(data.source, constellation))
+    constellation = toLegacyConstellation(id);
+
+  data.active[static_cast<size_t>(constellation)] |= (static_cast<uint64_t>(1) << (number - 1));
+}
+
+void GxGSA::handle_Dilution(char const * token, size_t const token_len, float & dop)
+{
+  if (token_len)
+    dop = util::parseFloat(token, token_len);
+  else
+    dop = NAN;
+}
+
+void GxGSA::handle_SystemId(char const * token, size_t const token_len, GsaData & data)
+{
+  if (!token_len)
+    return;
+
+  data.system_id = util::parseInt(token, token_len);
+
+  /* All satellites listed belong to the constellation denoted
+   * by the system id, NMEA 4.11 numbers them from 1 within
+   * each constellation.
+   */
+  uint64_t active = 0;
+  for (size_t c = 0; c < NUM_CONSTELLATIONS; c++)
+  {
+    active |= data.active[c];
+    data.active[c] = 0;
+  }
+
+  Constellation constellation;
+  if (toSystemConstellation(data.system_id, constellation))
+    data.active[static_cast<size_t>(constellation)] = active;
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
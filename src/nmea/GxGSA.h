@@ -0,0 +1,111 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_GXGSA_H_
+#define ARDUINO_NMEA_GXGSA_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdint.h>
+
+#include "Types.h"
+#include "util/field.h"
+#include "util/dispatch.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class GxGSA
+{
+
+public:
+
+  static void parse(char const * gxgsa, GsaData & data);
+  static void parse(char const * gxgsa, util::FieldIndex const & index, GsaSource const source, GsaData & data);
+
+  /* Decodes the single field 'field' of a GSA message, 0 being
+   * the message id, e.g. while the message is still received.
+   * Decoding all fields in ascending order into the same 'data'
+   * yields the same result as parse().
+   */
+  static void parseField(size_t const field, char const * token, size_t const token_len, GsaSource const source, GsaData & data);
+
+  /* Multi-constellation receivers send one GSA message per
+   * constellation. Merging each of them into 'latest' replaces
+   * the active satellites of the constellations covered by 'gsa'
+   * only, all other members are taken over from 'gsa'.
+   */
+  static void merge(GsaData const & gsa, GsaData & latest);
+
+private:
+
+  GxGSA() { }
+  GxGSA(GxGSA const &) { }
+
+  enum class Field : size_t
+  {
+    MessageId,
+    SelectionMode,
+    FixMode,
+    /* Twelve fields listing the ids of the satellites used. */
+    FirstSatelliteId,
+    LastSatelliteId = FirstSatelliteId + 11,
+    PositionDilutionOfPrecision,
+    HorizontalDilutionOfPrecision,
+    VerticalDilutionOfPrecision,
+    SystemId
+  };
+
+  static void handle_MessageId    (GsaSource const talker, GsaData & data);
+  static void handle_SelectionMode(char const * token, size_t const token_len, bool & is_automatic);
+  static void handle_FixMode      (char const * token, size_t const token_len, FixType & fix_type);
+  static void handle_SatelliteId  (char const * token, size_t const token_len, GsaData & data);
+  static void handle_Dilution     (char const * token, size_t const token_len, float & dop);
+  static void handle_SystemId     (char const * token, size_t const token_len, GsaData & data);
+};
+
+/* Describes the GSA message for the compile time sentence
+ * selection of nmea::NmeaParser, e.g. NmeaParser<Rmc, Gsa>.
+ */
+class Gsa
+{
+
+public:
+
+  typedef GsaData Data;
+
+  static constexpr util::Formatter formatter() { return util::toFormatter('G', 'S', 'A'); }
+  static Data invalid() { return INVALID_GSA; }
+  static void parse(char const * msg, util::FieldIndex const & index, GsaSource const source, Data & data) { GxGSA::parse(msg, index, source, data); }
+  static void parseField(size_t const field, char const * token, size_t const token_len, GsaSource const source, Data & data) { GxGSA::parseField(field, token, token_len, source, data); }
+
+  /* The latest data covers all constellations, see GxGSA::merge(). */
+  static void begin (Data const & /* latest */, Data & /* data */) { }
+  static void commit(Data const & data, Data & latest) { GxGSA::merge(data, latest); }
+
+  /* GSA messages carry neither time nor position. */
+  static size_t constexpr TIME_FIELD     = 0;
+  static size_t constexpr POSITION_FIELD = 0;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_GXGSA_H_ */
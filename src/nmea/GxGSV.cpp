@@ -0,0 +1,126 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "GxGSV.h"
+
+#include "util/numeric.h"
+#include "util/dispatch.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * PUBLIC MEMBER FUNCTIONS
+ **************************************************************************************/
+
+void GxGSV::parse(char const * gxgsv, GsvData & data)
+{
+  util::FieldIndex index;
+  util::buildFieldIndex(gxgsv, index);
+
+  char const * message_id = gxgsv + index.field[0].offset;
+  parse(gxgsv, index, util::parseTalker(message_id, index.field[0].length), data);
+}
+
+void GxGSV::parse(char const * gxgsv, util::FieldIndex const & index, GsvSource const source, GsvData & data)
+{
+  for (size_t f = 0; f < index.num_fields; f++)
+    parseField(f, gxgsv + index.field[f].offset, index.field[f].length, source, data);
+}
+
+void GxGSV::parseField(size_t const field, char const * token, size_t const token_len, GsvSource const source, GsvData & data)
+{
+  switch (static_cast<Field>(field))
+  {
+  case Field::MessageId:        handle_MessageId       (source, data);                             break;
+  case Field::NumberOfMessages: handle_NumberOfMessages(token, token_len, data.num_messages);      break;
+  case Field::MessageNumber:    handle_MessageNumber   (token, token_len, data.message_number);    break;
+  case Field::NumberSatellites: handle_NumberSatellites(token, token_len, data.num_satellites);    break;
+  default:                      handle_SatelliteField  (field - static_cast<size_t>(Field::SatelliteId), token, token_len, data); break;
+  }
+}
+
+/**************************************************************************************
+ * PRIVATE MEMBER FUNCTIONS
+ **************************************************************************************/
+
+void GxGSV::handle_MessageId(GsvSource const talker, GsvData & data)
+{
+  /* Every GSV message stands on its own, nothing is
+   * carried over from the previous one.
+   */
+  data = INVALID_GSV;
+  data.source = talker;
+}
+
+void GxGSV::handle_NumberOfMessages(char const * token, size_t const token_len, int & num_messages)
+{
+  num_messages = token_len ? util::parseInt(token, token_len) : -1;
+}
+
+void GxGSV::handle_MessageNumber(char const * token, size_t const token_len, int & message_number)
+{
+  message_number = token_len ? util::parseInt(token, token_len) : -1;
+}
+
+void GxGSV::handle_NumberSatellites(char const * token, size_t const token_len, int & num_satellites)
+{
+  num_satellites = token_len ? util::parseInt(token, token_len) : -1;
+}
+
+void GxGSV::handle_SatelliteField(size_t const field, char const * token, size_t const token_len, GsvData & data)
+{
+  /* The last GSV message of a sequence lists fewer than four
+   * satellites, hence the position of the optional signal id
+   * is derived from the number of satellites in view.
+   */
+  size_t num_listed = GSV_MAX_SATELLITES;
+  if (data.num_satellites >= 0 && data.message_number >= 1)
+  {
+    int const remaining = data.num_satellites - static_cast<int>(GSV_MAX_SATELLITES) * (data.message_number - 1);
+    num_listed = (remaining < 0) ? 0 : ((remaining < static_cast<int>(GSV_MAX_SATELLITES)) ? static_cast<size_t>(remaining) : GSV_MAX_SATELLITES);
+  }
+
+  size_t const entry = field / FIELDS_PER_SATELLITE;
+
+  if (entry >= num_listed)
+  {
+    if (field == num_listed * FIELDS_PER_SATELLITE)
+      data.signal_id = token_len ? util::parseInt(token, token_len) : -1;
+    return;
+  }
+
+  SatelliteInView & satellite = data.satellite[entry];
+  int const value = token_len ? util::parseInt(token, token_len) : -1;
+
+  switch (static_cast<Field>(static_cast<size_t>(Field::SatelliteId) + field % FIELDS_PER_SATELLITE))
+  {
+  case Field::SatelliteId:
+    satellite = INVALID_SATELLITE_IN_VIEW;
+    satellite.id = static_cast<int16_t>(value);
+    data.num_entries = entry + 1;
+    break;
+  case Field::Elevation: satellite.elevation = static_cast<int8_t>(value);  break;
+  case Field::Azimuth:   satellite.azimuth   = static_cast<int16_t>(value); break;
+  case Field::SNR:       satellite.snr       = static_cast<int8_t>(value);  break;
+  default:                                                                  break;
+  }
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
@@ -0,0 +1,110 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_GXGSV_H_
+#define ARDUINO_NMEA_GXGSV_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdint.h>
+
+#include "Types.h"
+#include "util/field.h"
+#include "util/dispatch.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Decodes a single GSV message, assembling the GSV messages
+ * of a sequence into a sky view is up to nmea::SkyViewAssembler.
+ */
+class GxGSV
+{
+
+public:
+
+  static void parse(char const * gxgsv, GsvData & data);
+  static void parse(char const * gxgsv, util::FieldIndex const & index, GsvSource const source, GsvData & data);
+
+  /* Decodes the single field 'field' of a GSV message, 0 being
+   * the message id, e.g. while the message is still received.
+   * Decoding all fields in ascending order into the same 'data'
+   * yields the same result as parse().
+   */
+  static void parseField(size_t const field, char const * token, size_t const token_len, GsvSource const source, GsvData & data);
+
+private:
+
+  GxGSV() { }
+  GxGSV(GxGSV const &) { }
+
+  enum class Field : size_t
+  {
+    MessageId,
+    NumberOfMessages,
+    MessageNumber,
+    NumberSatellites,
+    /* Each satellite is described by four fields. */
+    SatelliteId,
+    Elevation,
+    Azimuth,
+    SNR
+  };
+
+  static size_t constexpr FIELDS_PER_SATELLITE = 4;
+
+  static void handle_MessageId       (GsvSource const talker, GsvData & data);
+  static void handle_NumberOfMessages(char const * token, size_t const token_len, int & num_messages);
+  static void handle_MessageNumber   (char const * token, size_t const token_len, int & message_number);
+  static void handle_NumberSatellites(char const * token, size_t const token_len, int & num_satellites);
+  static void handle_SatelliteField  (size_t const field, char const * token, size_t const token_len, GsvData & data);
+};
+
+/* Describes the GSV message for the compile time sentence
+ * selection of nmea::NmeaParser, every single GSV message
+ * is delivered on its own.
+ */
+class Gsv
+{
+
+public:
+
+  typedef GsvData Data;
+
+  static constexpr util::Formatter formatter() { return util::toFormatter('G', 'S', 'V'); }
+  static Data invalid() { return INVALID_GSV; }
+  static void parse(char const * msg, util::FieldIndex const & index, GsvSource const source, Data & data) { GxGSV::parse(msg, index, source, data); }
+  static void parseField(size_t const field, char const * token, size_t const token_len, GsvSource const source, Data & data) { GxGSV::parseField(field, token, token_len, source, data); }
+
+  /* Every GSV message stands on its own. */
+  static void begin (Data const & /* latest */, Data & /* data */) { }
+  static void commit(Data const & data, Data & latest) { latest = data; }
+
+  /* GSV messages carry neither time nor position, hence they
+   * are only decoded ahead of the checksum if streaming.
+   */
+  static size_t constexpr TIME_FIELD     = 0;
+  static size_t constexpr POSITION_FIELD = 0;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_GXGSV_H_ */
@@ -13,17 +13,10 @@
 
 #include <string.h>
 
-#ifdef ARDUINO_ARCH_ESP32
-#  include <stdlib_noniso.h>
-#endif
-
-#ifdef ARDUINO_ARCH_RENESAS
-extern "C" char * _EXFUN(strsep,(char **, const char *));
-#endif
-
 #include "util/rmc.h"
 #include "util/common.h"
-#include "util/checksum.h"
+#include "util/numeric.h"
+#include "util/dispatch.h"
 
 /**************************************************************************************
  * NAMESPACE
@@ -42,77 +35,91 @@ constexpr float kts_to_m_per_s(float const v) { return (v / 1.9438444924574f); }
  * PUBLIC MEMBER FUNCTIONS
  **************************************************************************************/
 
-void GxRMC::parse(char * gxrmc, RmcData & data)
+void GxRMC::parse(char const * gxrmc, RmcData & data)
+{
+  util::FieldIndex index;
+  util::buildFieldIndex(gxrmc, index);
+
+  char const * message_id = gxrmc + index.field[0].offset;
+  parse(gxrmc, index, util::parseTalker(message_id, index.field[0].length), data);
+}
+
+void GxRMC::parse(char const * gxrmc, util::FieldIndex const & index, RmcSource const source, RmcData & data)
 {
   ParserState state = ParserState::MessageId;
 
-  /* Replace the '*' sign denoting the start of the checksum
-   * with a ',' in order to be able to tokenize all elements
-   * including the one before the checksum.
+  /* Each field of the NMEA message is directly accessed
+   * via the field index, the message itself is neither
+   * modified nor tokenized by inserting '\0' terminators.
    */
-  *strchr(gxrmc, '*') = ',';
+  for (size_t f = 0; (f < index.num_fields) && (state != ParserState::Done); f++)
+    state = handle(state, gxrmc + index.field[f].offset, index.field[f].length, source, data);
+}
 
-  for (char * token = strsep(&gxrmc, ",");
-       token != nullptr;
-       token = strsep(&gxrmc, ","))
-  {
-    ParserState next_state = state;
-
-    switch(state)
-    {
-    case ParserState::MessageId:                  next_state = handle_MessageId                (token, data.source);             break;
-    case ParserState::UTCPositionFix:             next_state = handle_UTCPositionFix           (token, data.time_utc);           break;
-    case ParserState::Status:                     next_state = handle_Status                   (token, data.is_valid);           break;
-    case ParserState::LatitudeVal:                next_state = handle_LatitudeVal              (token, data.latitude);           break;
-    case ParserState::LatitudeNS:                 next_state = handle_LatitudeNS               (token, data.latitude);           break;
-    case ParserState::LongitudeVal:               next_state = handle_LongitudeVal             (token, data.longitude);          break;
-    case ParserState::LongitudeEW:                next_state = handle_LongitudeEW              (token, data.longitude);          break;
-    case ParserState::SpeedOverGround:            next_state = handle_SpeedOverGround          (token, data.speed);              break;
-    case ParserState::TrackAngle:                 next_state = handle_TrackAngle               (token, data.course);             break;
-    case ParserState::Date:                       next_state = handle_Date                     (token, data.date);               break;
-    case ParserState::MagneticVariation:          next_state = handle_MagneticVariation        (token, data.magnetic_variation); break;
-    case ParserState::MagneticVariationEastWest:  next_state = handle_MagneticVariationEastWest(token, data.magnetic_variation); break;
-    case ParserState::Checksum:                   next_state = handle_Checksum                 (token);                          break;
-    case ParserState::Done:                                                                                                      break;
-    };
-
-    state = next_state;
-  }
+void GxRMC::parseField(size_t const field, char const * token, size_t const token_len, RmcSource const source, RmcData & data)
+{
+  static_assert(TIME_FIELD     == static_cast<size_t>(ParserState::UTCPositionFix), "TIME_FIELD needs to denote the time field");
+  static_assert(POSITION_FIELD == static_cast<size_t>(ParserState::LongitudeEW),    "POSITION_FIELD needs to denote the last field of the position");
+
+  /* Each field is handled by its own state, the state
+   * machine advances by exactly one state per field.
+   */
+  if (field < static_cast<size_t>(ParserState::Done))
+    handle(static_cast<ParserState>(field), token, token_len, source, data);
 }
 
 /**************************************************************************************
  * PRIVATE MEMBER FUNCTIONS
  **************************************************************************************/
 
-GxRMC::ParserState GxRMC::handle_MessageId(char const * token, RmcSource & source)
+GxRMC::ParserState GxRMC::handle(ParserState const state, char const * token, size_t const token_len, RmcSource const source, RmcData & data)
 {
-  if (util::rmc_isGPRMC(token))
-    source = RmcSource::GPS;
-  else if (util::rmc_isGLRMC(token))
-    source = RmcSource::GLONASS;
-  else if (util::rmc_isGARMC(token))
-    source = RmcSource::Galileo;
-  else if (util::rmc_isGNRMC(token))
-    source = RmcSource::GNSS;
-  else if (util::rmc_isBDRMC(token))
-    source = RmcSource::BDS;
+  ParserState next_state = state;
+
+  switch(state)
+  {
+  case ParserState::MessageId:                  next_state = handle_MessageId                (source, data.source);                                 break;
+  case ParserState::UTCPositionFix:             next_state = handle_UTCPositionFix           (token, token_len, data.time_utc);                     break;
+  case ParserState::Status:                     next_state = handle_Status                   (token, token_len, data.is_valid);                     break;
+  case ParserState::LatitudeVal:                next_state = handle_LatitudeVal              (token, token_len, data.latitude, data.latitude_e7);   break;
+  case ParserState::LatitudeNS:                 next_state = handle_LatitudeNS               (token, token_len, data.latitude, data.latitude_e7);   break;
+  case ParserState::LongitudeVal:               next_state = handle_LongitudeVal             (token, token_len, data.longitude, data.longitude_e7); break;
+  case ParserState::LongitudeEW:                next_state = handle_LongitudeEW              (token, token_len, data.longitude, data.longitude_e7); break;
+  case ParserState::SpeedOverGround:            next_state = handle_SpeedOverGround          (token, token_len, data.speed);                        break;
+  case ParserState::TrackAngle:                 next_state = handle_TrackAngle               (token, token_len, data.course);                       break;
+  case ParserState::Date:                       next_state = handle_Date                     (token, token_len, data.date);                         break;
+  case ParserState::MagneticVariation:          next_state = handle_MagneticVariation        (token, token_len, data.magnetic_variation);           break;
+  case ParserState::MagneticVariationEastWest:  next_state = handle_MagneticVariationEastWest(token, token_len, data.magnetic_variation);           break;
+  case ParserState::Done:                                                                                                                           break;
+  };
+
+  return next_state;
+}
+
+GxRMC::ParserState GxRMC::handle_MessageId(RmcSource const talker, RmcSource & source)
+{
+  /* The talker id has already been decoded when
+   * dispatching the NMEA message to this decoder.
+   */
+  if (talker != RmcSource::Unknown)
+    source = talker;
 
   return ParserState::UTCPositionFix;
 }
 
-GxRMC::ParserState GxRMC::handle_UTCPositionFix(char const * token, Time & time_utc)
+GxRMC::ParserState GxRMC::handle_UTCPositionFix(char const * token, size_t const token_len, Time & time_utc)
 {
-  if (strlen(token))
-    util::parseTime(token, time_utc);
+  if (token_len)
+    util::parseTime(token, token_len, time_utc);
   else
     time_utc = INVALID_TIME;
 
   return ParserState::Status;
 }
 
-GxRMC::ParserState GxRMC::handle_Status(char const * token, bool & is_valid)
+GxRMC::ParserState GxRMC::handle_Status(char const * token, size_t const token_len, bool & is_valid)
 {
-  if(strlen(token) > 0 && !strncmp(token, "A", 1))
+  if (token_len > 0 && (token[0] == 'A'))
     is_valid = true;
   else
     is_valid = false;
@@ -120,92 +127,107 @@ GxRMC::ParserState GxRMC::handle_Status(char const * token, bool & is_valid)
   return ParserState::LatitudeVal;
 }
 
-GxRMC::ParserState GxRMC::handle_LatitudeVal(char const * token, float & latitude)
+GxRMC::ParserState GxRMC::handle_LatitudeVal(char const * token, size_t const token_len, float & latitude, int32_t & latitude_e7)
 {
-  if (strlen(token))
-    latitude = util::parseLatitude(token);
+  if (token_len)
+  {
+    latitude    = util::parseLatitude  (token, token_len);
+    latitude_e7 = util::parseLatitudeE7(token, token_len);
+  }
   else
-    latitude = NAN;
+  {
+    latitude    = NAN;
+    latitude_e7 = INVALID_COORDINATE_E7;
+  }
 
   return ParserState::LatitudeNS;
 }
 
-GxRMC::ParserState GxRMC::handle_LatitudeNS(char const * token, float & latitude)
+GxRMC::ParserState GxRMC::handle_LatitudeNS(char const * token, size_t const token_len, float & latitude, int32_t & latitude_e7)
 {
-  if (strlen(token) > 0  && !strncmp(token, "S", 1))
+  if (token_len > 0 && (token[0] == 'S'))
+  {
     latitude *= (-1.0f);
+    if (latitude_e7 != INVALID_COORDINATE_E7)
+      latitude_e7 = -latitude_e7;
+  }
 
   return ParserState::LongitudeVal;
 }
 
-GxRMC::ParserState GxRMC::handle_LongitudeVal(char const * token, float & longitude)
+GxRMC::ParserState GxRMC::handle_LongitudeVal(char const * token, size_t const token_len, float & longitude, int32_t & longitude_e7)
 {
-  if (strlen(token))
-    longitude = util::parseLongitude(token);
+  if (token_len)
+  {
+    longitude    = util::parseLongitude  (token, token_len);
+    longitude_e7 = util::parseLongitudeE7(token, token_len);
+  }
   else
-    longitude = NAN;
+  {
+    longitude    = NAN;
+    longitude_e7 = INVALID_COORDINATE_E7;
+  }
 
   return ParserState::LongitudeEW;
 }
 
-GxRMC::ParserState GxRMC::handle_LongitudeEW(char const * token, float & longitude)
+GxRMC::ParserState GxRMC::handle_LongitudeEW(char const * token, size_t const token_len, float & longitude, int32_t & longitude_e7)
 {
-  if (strlen(token) > 0 && !strncmp(token, "W", 1))
+  if (token_len > 0 && (token[0] == 'W'))
+  {
     longitude *= (-1.0f);
+    if (longitude_e7 != INVALID_COORDINATE_E7)
+      longitude_e7 = -longitude_e7;
+  }
 
   return ParserState::SpeedOverGround;
 }
 
-GxRMC::ParserState GxRMC::handle_SpeedOverGround(char const * token, float & speed)
+GxRMC::ParserState GxRMC::handle_SpeedOverGround(char const * token, size_t const token_len, float & speed)
 {
-  if (strlen(token))
-    speed = kts_to_m_per_s(atof(token));
+  if (token_len)
+    speed = kts_to_m_per_s(util::parseFloat(token, token_len));
   else
     speed = NAN;
 
   return ParserState::TrackAngle;
 }
 
-GxRMC::ParserState GxRMC::handle_TrackAngle(char const * token, float & course)
+GxRMC::ParserState GxRMC::handle_TrackAngle(char const * token, size_t const token_len, float & course)
 {
-  if (strlen(token))
-    course = atof(token);
+  if (token_len)
+    course = util::parseFloat(token, token_len);
   else
     course = NAN;
 
   return ParserState::Date;
 }
 
-GxRMC::ParserState GxRMC::handle_Date(char const * token, Date & date)
+GxRMC::ParserState GxRMC::handle_Date(char const * token, size_t const token_len, Date & date)
 {
-  if (strlen(token))
-    util::rmc_parseDate(token, date);
+  if (token_len)
+    util::rmc_parseDate(token, token_len, date);
   else
     date = INVALID_DATE;
 
   return ParserState::MagneticVariation;
 }
 
-GxRMC::ParserState GxRMC::handle_MagneticVariation(char const * token, float & magnetic_variation)
+GxRMC::ParserState GxRMC::handle_MagneticVariation(char const * token, size_t const token_len, float & magnetic_variation)
 {
-  if (strlen(token) > 0)
-    magnetic_variation = atof(token);
+  if (token_len > 0)
+    magnetic_variation = util::parseFloat(token, token_len);
   else
     magnetic_variation = NAN;
 
   return ParserState::MagneticVariationEastWest;
 }
 
-GxRMC::ParserState GxRMC::handle_MagneticVariationEastWest(char const * token, float & magnetic_variation)
+GxRMC::ParserState GxRMC::handle_MagneticVariationEastWest(char const * token, size_t const token_len, float & magnetic_variation)
 {
-  if(!strncmp(token, "W", 1))
+  if (token_len > 0 && (token[0] == 'W'))
     magnetic_variation *= (-1.0f);
 
-  return ParserState::Checksum;
-}
-
-GxRMC::ParserState GxRMC::handle_Checksum(char const * /* token */)
-{
   return ParserState::Done;
 }
 
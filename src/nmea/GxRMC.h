@@ -15,6 +15,8 @@
 #include <stdint.h>
 
 #include "Types.h"
+#include "util/field.h"
+#include "util/dispatch.h"
 
 /**************************************************************************************
  * NAMESPACE
@@ -32,7 +34,21 @@ class GxRMC
 
 public:
 
-  static void parse(char * gxrmc, RmcData & data);
+  static void parse(char const * gxrmc, RmcData & data);
+  static void parse(char const * gxrmc, util::FieldIndex const & index, RmcSource const source, RmcData & data);
+
+  /* Decodes the single field 'field' of a RMC message, 0 being
+   * the message id, e.g. while the message is still received.
+   * Decoding all fields in ascending order into the same 'data'
+   * yields the same result as parse().
+   */
+  static void parseField(size_t const field, char const * token, size_t const token_len, RmcSource const source, RmcData & data);
+
+  /* The time is complete after decoding field TIME_FIELD,
+   * latitude and longitude after decoding POSITION_FIELD.
+   */
+  static size_t constexpr TIME_FIELD     = 1;
+  static size_t constexpr POSITION_FIELD = 6;
 
 private:
 
@@ -53,23 +69,46 @@ private:
     Date,
     MagneticVariation,
     MagneticVariationEastWest,
-    Checksum,
     Done
   };
 
-  static ParserState handle_MessageId                (char const * token, RmcSource & source);
-  static ParserState handle_UTCPositionFix           (char const * token, Time & time_utc);
-  static ParserState handle_Status                   (char const * token, bool & is_valid);
-  static ParserState handle_LatitudeVal              (char const * token, float & latitude);
-  static ParserState handle_LatitudeNS               (char const * token, float & latitude);
-  static ParserState handle_LongitudeVal             (char const * token, float & longitude);
-  static ParserState handle_LongitudeEW              (char const * token, float & longitude);
-  static ParserState handle_SpeedOverGround          (char const * token, float & speed);
-  static ParserState handle_TrackAngle               (char const * token, float & course);
-  static ParserState handle_Date                     (char const * token, Date & date);
-  static ParserState handle_MagneticVariation        (char const * token, float & magnetic_variation);
-  static ParserState handle_MagneticVariationEastWest(char const * token, float & magnetic_variation);
-  static ParserState handle_Checksum                 (char const * token);
+  static ParserState handle(ParserState const state, char const * token, size_t const token_len, RmcSource const source, RmcData & data);
+
+  static ParserState handle_MessageId                (RmcSource const talker, RmcSource & source);
+  static ParserState handle_UTCPositionFix           (char const * token, size_t const token_len, Time & time_utc);
+  static ParserState handle_Status                   (char const * token, size_t const token_len, bool & is_valid);
+  static ParserState handle_LatitudeVal              (char const * token, size_t const token_len, float & latitude, int32_t & latitude_e7);
+  static ParserState handle_LatitudeNS               (char const * token, size_t const token_len, float & latitude, int32_t & latitude_e7);
+  static ParserState handle_LongitudeVal             (char const * token, size_t const token_len, float & longitude, int32_t & longitude_e7);
+  static ParserState handle_LongitudeEW              (char const * token, size_t const token_len, float & longitude, int32_t & longitude_e7);
+  static ParserState handle_SpeedOverGround          (char const * token, size_t const token_len, float & speed);
+  static ParserState handle_TrackAngle               (char const * token, size_t const token_len, float & course);
+  static ParserState handle_Date                     (char const * token, size_t const token_len, Date & date);
+  static ParserState handle_MagneticVariation        (char const * token, size_t const token_len, float & magnetic_variation);
+  static ParserState handle_MagneticVariationEastWest(char const * token, size_t const token_len, float & magnetic_variation);
+};
+
+/* Describes the RMC message for the compile time sentence
+ * selection of nmea::NmeaParser, e.g. NmeaParser<Rmc, Gga>.
+ */
+class Rmc
+{
+
+public:
+
+  typedef RmcData Data;
+
+  static constexpr util::Formatter formatter() { return util::toFormatter('R', 'M', 'C'); }
+  static Data invalid() { return INVALID_RMC; }
+  static void parse(char const * msg, util::FieldIndex const & index, RmcSource const source, Data & data) { GxRMC::parse(msg, index, source, data); }
+  static void parseField(size_t const field, char const * token, size_t const token_len, RmcSource const source, Data & data) { GxRMC::parseField(field, token, token_len, source, data); }
+
+  /* Decoding starts out from the previously decoded RMC data. */
+  static void begin (Data const & latest, Data & data) { data = latest; }
+  static void commit(Data const & data, Data & latest) { latest = data; }
+
+  static size_t constexpr TIME_FIELD     = GxRMC::TIME_FIELD;
+  static size_t constexpr POSITION_FIELD = GxRMC::POSITION_FIELD;
 };
 
 /**************************************************************************************
@@ -0,0 +1,598 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_NMEA_DECODER_H_
+#define ARDUINO_NMEA_NMEA_DECODER_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#undef max
+#undef min
+#include <type_traits>
+
+#include "Types.h"
+#include "GxGSV.h"
+#include "SkyView.h"
+#include "NmeaFramer.h"
+#include "Profiling.h"
+#include "Statistics.h"
+#include "util/field.h"
+#include "util/dispatch.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* Invoked once the checksum of a NMEA message which has been
+ * delivered provisionally has been verified, see early dispatch.
+ */
+typedef void (*VerdictCallback)(Verdict const verdict, void * context);
+
+/**************************************************************************************
+ * INTERNAL CLASS DECLARATION
+ **************************************************************************************/
+
+namespace detail
+{
+
+/* Decoded data and callbacks of a single NMEA message. */
+template <typename Sentence>
+class SentenceSlot
+{
+public:
+  typedef void (*Callback)(typename Sentence::Data const & data, void * context);
+  typedef void (*ProvisionalCallback)(typename Sentence::Data const & data, Provisional const available, void * context);
+
+  SentenceSlot()
+  : data(Sentence::invalid())
+  , pending(Sentence::invalid())
+  , callback(nullptr)
+  , provisional_callback(nullptr)
+  { }
+
+  typename Sentence::Data data;
+  /* Being decoded, taken over by 'data' once complete. */
+  typename Sentence::Data pending;
+  Callback callback;
+  ProvisionalCallback provisional_callback;
+};
+
+/* Inherits one slot per selected NMEA message, listing the
+ * same message twice is therefore rejected by the compiler.
+ */
+template <typename... Sentences>
+class SentenceSlots : public SentenceSlot<Sentences>... { };
+
+/* Position of 'Sentence' within 'Sentences' or DISPATCH_SLOT_EMPTY. */
+template <typename Sentence>
+constexpr uint8_t indexOf(uint8_t const) { return util::DISPATCH_SLOT_EMPTY; }
+
+template <typename Sentence, typename Head, typename... Tail>
+constexpr uint8_t indexOf(uint8_t const idx = 0)
+{
+  return std::is_same<Sentence, Head>::value ? idx : indexOf<Sentence, Tail...>(idx + 1);
+}
+
+} /* detail */
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Decodes the NMEA messages listed as template parameters, e.g.
+ * NmeaDecoder<Rmc, Gga>, as they are delivered by a NmeaFramer
+ * and notifies the user about updates. It is independent of the
+ * parse buffer size, see FramedDecoder for feeding it with the
+ * received characters. Both the dispatch table and the storage
+ * for the decoded data are built at compile time, the decoders
+ * of all other NMEA messages are neither instantiated nor linked.
+ */
+template <typename... Sentences>
+class NmeaDecoder
+{
+
+public:
+
+  static_assert(sizeof...(Sentences) > 0, "At least one NMEA message needs to be selected");
+
+
+  NmeaDecoder(void * context = nullptr)
+  : _error{Error::None}
+  , _epoch_day_cache{INVALID_EPOCH_DAY_CACHE}
+  , _context{context}
+  , _on_verdict_callback{nullptr}
+  , _streamed_entry{util::DISPATCH_SLOT_EMPTY}
+  , _streamed_talker{RmcSource::Unknown}
+  , _is_provisional{false}
+  , _is_streaming{false}
+  , _is_message_id_streamed{false}
+  , _sky_view{nullptr}
+#if NMEA_PARSER_ENABLE_STATISTICS
+  , _statistics{}
+  , _decoded_messages{0}
+#endif
+#if NMEA_PARSER_ENABLE_PROFILING
+  , _timestamp_source{noTimestamp}
+  , _decoded_timestamp{0}
+  , _profile{}
+#endif
+  {
+    static_assert(util::isCollisionFree(FORMATTERS), "Each formatter needs to occupy its own slot of the dispatch table");
+  }
+
+
+  /* Registers the function which is called with the user supplied
+   * context every time a NMEA message of type 'Sentence' has been
+   * decoded, e.g. parser.onUpdate<nmea::Rmc>(onRmcUpdate).
+   */
+  template <typename Sentence>
+  inline void onUpdate(typename detail::SentenceSlot<Sentence>::Callback callback) { slot<Sentence>().callback = callback; }
+
+  template <typename Sentence>
+  inline typename Sentence::Data const & data() const { return slot<Sentence>().data; }
+
+  /* GSV messages are only decoded once a sky view assembler or
+   * an update callback has been registered, the assembler then
+   * publishes one sky view per epoch. Passing nullptr stops
+   * assembling the sky view again.
+   */
+  void setSkyView(SkyViewAssembler * sky_view)
+  {
+    static_assert(GSV_ENTRY != util::DISPATCH_SLOT_EMPTY, "nmea::Gsv needs to be selected for assembling the sky view");
+    _sky_view = sky_view;
+  }
+
+  /* Same as nmea::toPosixTimestamp but the conversion of the
+   * date is only repeated when it differs from the date of the
+   * previous call, which typically only happens once a day.
+   */
+  inline time_t toPosixTimestamp(Date const & date, Time const & time) { return nmea::toPosixTimestamp(date, time, _epoch_day_cache); }
+
+
+  enum class Error { None, Checksum };
+
+  inline void  clearerr()       { _error = Error::None; }
+  inline Error error   () const { return _error; }
+
+#if NMEA_PARSER_ENABLE_STATISTICS
+  /* Number of decoded NMEA messages of type 'Sentence'. */
+  template <typename Sentence>
+  inline uint32_t decodedMessages() const { return _decoded_messages[detail::indexOf<Sentence, Sentences...>()]; }
+#endif
+
+#if NMEA_PARSER_ENABLE_PROFILING
+  inline void setTimestampSource(TimestampSource const source) { _timestamp_source = source; }
+
+  /* profile().sentence[] is ordered like the template parameters,
+   * the last entry covers all NMEA messages which are not decoded.
+   */
+  inline Profile<sizeof...(Sentences)> const & profile() const { return _profile; }
+#endif
+
+
+protected:
+
+#if NMEA_PARSER_ENABLE_STATISTICS
+  inline void countReceivedBytes(size_t const num_bytes) { _statistics.received_bytes += num_bytes; }
+
+  inline Statistics statistics(uint32_t const discarded_bytes) const
+  {
+    Statistics statistics = _statistics;
+    statistics.discarded_bytes = discarded_bytes;
+    return statistics;
+  }
+#endif
+
+  inline uint32_t timestamp() const
+  {
+#if NMEA_PARSER_ENABLE_PROFILING
+    return _timestamp_source();
+#else
+    return 0;
+#endif
+  }
+
+#if NMEA_PARSER_ENABLE_PROFILING
+  inline void recordFraming(uint32_t const duration) { record(_profile.framing, duration); }
+#endif
+
+  template <typename Sentence>
+  inline void setProvisionalCallback(typename detail::SentenceSlot<Sentence>::ProvisionalCallback callback)
+  {
+    static_assert(Sentence::POSITION_FIELD > 0, "Only NMEA messages carrying time and position are dispatched early");
+    slot<Sentence>().provisional_callback = callback;
+  }
+  inline void setVerdictCallback(VerdictCallback const callback) { _on_verdict_callback = callback; }
+
+  /* A NMEA message which is already being received when
+   * enabling streaming is decoded as a whole.
+   */
+  inline void setStreaming(bool const enable) { _is_streaming = enable; _is_message_id_streamed = false; }
+
+  /* True if the decoder requires FramerEvent::Field. */
+  bool needsFields() const
+  {
+    bool const is_provisional[] = {(slot<Sentences>().provisional_callback != nullptr)...};
+    bool needs_fields = _is_streaming || _on_verdict_callback;
+    for (bool const p : is_provisional)
+      needs_fields = needs_fields || p;
+    return needs_fields;
+  }
+
+  void onFramerEvent(FramerEvent const event, char const * message, ReceiveTime const & received)
+  {
+    if (event == FramerEvent::None)
+      return;
+
+    /* Every message which has been delivered provisionally is
+     * either confirmed or retracted before anything else happens.
+     */
+    uint8_t const streamed_entry = _streamed_entry;
+    bool const is_streamed = _is_streaming && _is_message_id_streamed;
+    _streamed_entry = util::DISPATCH_SLOT_EMPTY;
+    _is_message_id_streamed = false;
+    if (_is_provisional)
+    {
+      _is_provisional = false;
+      if (_on_verdict_callback)
+        _on_verdict_callback((event == FramerEvent::Message) ? Verdict::Confirmed : Verdict::Retracted, _context);
+    }
+
+    if (event == FramerEvent::Discarded)
+      return;
+
+#if NMEA_PARSER_ENABLE_STATISTICS
+    if (event == FramerEvent::Overflow)
+      _statistics.overflows++;
+    else
+      _statistics.framed_messages++;
+#endif
+
+    if (event == FramerEvent::ChecksumError)
+    {
+#if NMEA_PARSER_ENABLE_STATISTICS
+      _statistics.checksum_errors++;
+#endif
+      _error = Error::Checksum;
+    }
+    else if (event == FramerEvent::Message)
+    {
+      if (is_streamed)
+        commitStreamedMessage(streamed_entry, received);
+      else
+        processNmeaMessage(message, received);
+    }
+  }
+
+  void onFramerField(char const * message, util::Field const & field, size_t const field_number, ReceiveTime const & received)
+  {
+    char const * token = message + field.offset;
+    size_t const token_len = field.length;
+
+    /* The decoder is selected once the message id is complete,
+     * all further fields are handed over to it as they arrive.
+     */
+    if (field_number == 0)
+    {
+      util::Formatter const formatter = util::parseFormatter(token, token_len);
+      _streamed_talker = (formatter != util::INVALID_FORMATTER) ? util::parseTalker(token, token_len) : RmcSource::Unknown;
+      _streamed_entry = util::DISPATCH_SLOT_EMPTY;
+      if (_streamed_talker != RmcSource::Unknown)
+        _streamed_entry = lookupEntry(formatter);
+      _is_message_id_streamed = true;
+    }
+
+    if (_streamed_entry != util::DISPATCH_SLOT_EMPTY)
+      (this->*FIELD_HANDLERS[_streamed_entry])(field_number, token, token_len, received);
+  }
+
+
+private:
+
+  typedef void (NmeaDecoder::*SentenceHandler)(char const *, RmcSource const, util::FieldIndex const &, ReceiveTime const &);
+  typedef void (NmeaDecoder::*FieldHandler)(size_t const, char const *, size_t const, ReceiveTime const &);
+  typedef void (NmeaDecoder::*CommitHandler)(ReceiveTime const &);
+
+  static util::Formatter constexpr FORMATTERS[] = {Sentences::formatter()...};
+  static util::DispatchTable constexpr DISPATCH_TABLE = util::makeDispatchTable(FORMATTERS);
+  static SentenceHandler const SENTENCE_HANDLERS[sizeof...(Sentences)];
+  static FieldHandler const FIELD_HANDLERS[sizeof...(Sentences)];
+  static CommitHandler const COMMIT_HANDLERS[sizeof...(Sentences)];
+
+  /* GSV messages are assembled into a sky view, every other
+   * NMEA message marks the end of the current epoch.
+   */
+  static uint8_t constexpr GSV_ENTRY = detail::indexOf<Gsv, Sentences...>();
+  typedef std::integral_constant<bool, GSV_ENTRY != util::DISPATCH_SLOT_EMPTY> HasSkyView;
+
+  Error _error;
+  detail::SentenceSlots<Sentences...> _slots;
+  EpochDayCache _epoch_day_cache;
+  void * _context;
+  VerdictCallback _on_verdict_callback;
+  uint8_t _streamed_entry;
+  RmcSource _streamed_talker;
+  bool _is_provisional;
+  bool _is_streaming;
+  bool _is_message_id_streamed;
+  SkyViewAssembler * _sky_view;
+#if NMEA_PARSER_ENABLE_STATISTICS
+  Statistics _statistics;
+  uint32_t _decoded_messages[sizeof...(Sentences)];
+#endif
+#if NMEA_PARSER_ENABLE_PROFILING
+  TimestampSource _timestamp_source;
+  uint32_t _decoded_timestamp;
+  Profile<sizeof...(Sentences)> _profile;
+#endif
+
+  template <typename Sentence>
+  inline detail::SentenceSlot<Sentence> & slot() { return _slots; }
+  template <typename Sentence>
+  inline detail::SentenceSlot<Sentence> const & slot() const { return _slots; }
+
+  /* Returns the index of the decoder for 'formatter' or
+   * DISPATCH_SLOT_EMPTY if the NMEA message is not supported.
+   */
+  static inline uint8_t lookupEntry(util::Formatter const formatter)
+  {
+    uint8_t const entry = DISPATCH_TABLE.entry[util::toDispatchSlot(formatter)];
+    if (entry != util::DISPATCH_SLOT_EMPTY && FORMATTERS[entry] != formatter)
+      return util::DISPATCH_SLOT_EMPTY;
+    return entry;
+  }
+
+  void processNmeaMessage(char const * message, ReceiveTime const & received)
+  {
+#if NMEA_PARSER_ENABLE_PROFILING
+    uint32_t const start = timestamp();
+#endif
+    /* Determine the position of all fields within the NMEA
+     * message in a single pass, the field index is then used
+     * by the individual decoders to access the fields.
+     */
+    util::FieldIndex index;
+    util::buildFieldIndex(message, index);
+#if NMEA_PARSER_ENABLE_PROFILING
+    uint32_t const indexed = timestamp();
+#endif
+
+    /* Look up the decoder for the NMEA message via its
+     * formatter, i.e. "RMC" in "$GPRMC", which takes the
+     * same time regardless of the number of supported
+     * NMEA messages. The talker id, i.e. "GP" in "$GPRMC",
+     * is decoded once and handed over to the decoder.
+     */
+    char const * message_id = message + index.field[0].offset;
+    size_t const message_id_len = index.field[0].length;
+
+    util::Formatter const formatter = util::parseFormatter(message_id, message_id_len);
+    RmcSource const talker = util::parseTalker(message_id, message_id_len);
+
+    uint8_t entry = util::DISPATCH_SLOT_EMPTY;
+    if (formatter != util::INVALID_FORMATTER && talker != RmcSource::Unknown)
+    {
+#if NMEA_PARSER_ENABLE_STATISTICS
+      _statistics.talker_messages[static_cast<size_t>(talker)]++;
+#endif
+      entry = lookupEntry(formatter);
+    }
+#if NMEA_PARSER_ENABLE_PROFILING
+    uint32_t const dispatched = timestamp();
+#endif
+
+    flushSkyView(entry, HasSkyView());
+
+    if (entry != util::DISPATCH_SLOT_EMPTY)
+    {
+#if NMEA_PARSER_ENABLE_STATISTICS
+      _decoded_messages[entry]++;
+#endif
+      (this->*SENTENCE_HANDLERS[entry])(message, talker, index, received);
+    }
+#if NMEA_PARSER_ENABLE_STATISTICS
+    else
+      _statistics.unknown_messages++;
+#endif
+
+#if NMEA_PARSER_ENABLE_PROFILING
+    /* Recording only takes place after all stages have completed
+     * in order not to add its own cost to the measurements.
+     */
+    uint32_t const notified = timestamp();
+    SentenceProfile & profile = _profile.sentence[(entry != util::DISPATCH_SLOT_EMPTY) ? entry : sizeof...(Sentences)];
+    record(profile.field_index, indexed - start);
+    record(profile.dispatch, dispatched - indexed);
+    if (entry != util::DISPATCH_SLOT_EMPTY)
+    {
+      record(profile.decode, _decoded_timestamp - dispatched);
+      record(profile.callback, notified - _decoded_timestamp);
+      record(profile.latency, _decoded_timestamp - received.last_byte);
+    }
+#endif
+  }
+
+  void commitStreamedMessage(uint8_t const entry, ReceiveTime const & received)
+  {
+#if NMEA_PARSER_ENABLE_PROFILING
+    uint32_t const start = timestamp();
+#endif
+    /* All fields have already been decoded while the message
+     * was received, only the result is taken over once the
+     * checksum has been verified.
+     */
+#if NMEA_PARSER_ENABLE_STATISTICS
+    if (_streamed_talker != RmcSource::Unknown)
+      _statistics.talker_messages[static_cast<size_t>(_streamed_talker)]++;
+#endif
+
+    flushSkyView(entry, HasSkyView());
+
+    if (entry != util::DISPATCH_SLOT_EMPTY)
+    {
+#if NMEA_PARSER_ENABLE_STATISTICS
+      _decoded_messages[entry]++;
+#endif
+      (this->*COMMIT_HANDLERS[entry])(received);
+    }
+#if NMEA_PARSER_ENABLE_STATISTICS
+    else
+      _statistics.unknown_messages++;
+#endif
+
+#if NMEA_PARSER_ENABLE_PROFILING
+    /* The decode stage only covers taking over the result. */
+    if (entry != util::DISPATCH_SLOT_EMPTY)
+    {
+      uint32_t const notified = timestamp();
+      SentenceProfile & profile = _profile.sentence[entry];
+      record(profile.decode, _decoded_timestamp - start);
+      record(profile.callback, notified - _decoded_timestamp);
+      record(profile.latency, _decoded_timestamp - received.last_byte);
+    }
+#endif
+  }
+
+  template <typename Sentence>
+  void parseSentence(char const * message, RmcSource const source, util::FieldIndex const & index, ReceiveTime const & received)
+  {
+    detail::SentenceSlot<Sentence> & s = slot<Sentence>();
+
+    /* Without anybody interested in the result it is not decoded. */
+    if (isObserved(s))
+    {
+      Sentence::begin(s.data, s.pending);
+      Sentence::parse(message, index, source, s.pending);
+    }
+    else
+      s.pending = Sentence::invalid();
+
+    update(s, received);
+  }
+
+  template <typename Sentence>
+  void parseField(size_t const field_number, char const * token, size_t const token_len, ReceiveTime const & received)
+  {
+    /* Unless streaming only the fields up to the position are
+     * decoded ahead of the checksum, the confirmed message is
+     * then decoded as a whole.
+     */
+    if (!_is_streaming && (Sentence::POSITION_FIELD == 0 || field_number > Sentence::POSITION_FIELD))
+      return;
+
+    detail::SentenceSlot<Sentence> & s = slot<Sentence>();
+
+    if (field_number == 0)
+    {
+      Sentence::begin(s.data, s.pending);
+      s.pending.received = INVALID_RECEIVE_TIME;
+      s.pending.received.first_byte = received.first_byte;
+    }
+
+    Sentence::parseField(field_number, token, token_len, _streamed_talker, s.pending);
+
+    if (!s.provisional_callback)
+      return;
+
+    if (field_number == Sentence::TIME_FIELD)
+    {
+      _is_provisional = true;
+      s.provisional_callback(s.pending, Provisional::Time, _context);
+    }
+    else if (field_number == Sentence::POSITION_FIELD)
+    {
+      _is_provisional = true;
+      s.provisional_callback(s.pending, Provisional::Position, _context);
+    }
+  }
+
+  template <typename Sentence>
+  void commitSentence(ReceiveTime const & received)
+  {
+    update(slot<Sentence>(), received);
+  }
+
+  template <typename Sentence>
+  void update(detail::SentenceSlot<Sentence> & s, ReceiveTime const & received)
+  {
+    Sentence::commit(s.pending, s.data);
+    s.data.received = received;
+#if NMEA_PARSER_ENABLE_PROFILING
+    _decoded_timestamp = timestamp();
+#endif
+
+    publish(s);
+
+    if (s.callback)
+      s.callback(s.data, _context);
+  }
+
+  /* The GSV specific overloads are only instantiated if nmea::Gsv
+   * is selected, otherwise the sky view assembler is not linked.
+   */
+  template <typename Sentence>
+  inline bool isObserved(detail::SentenceSlot<Sentence> const &) const { return true; }
+  inline bool isObserved(detail::SentenceSlot<Gsv> const & s) const { return _sky_view || s.callback; }
+
+  template <typename Sentence>
+  inline void publish(detail::SentenceSlot<Sentence> const &) { }
+  inline void publish(detail::SentenceSlot<Gsv> const & s) { if (_sky_view) _sky_view->add(s.data); }
+
+  inline void flushSkyView(uint8_t const /* entry */, std::false_type) { }
+  inline void flushSkyView(uint8_t const entry, std::true_type) { if (_sky_view && entry != GSV_ENTRY) _sky_view->flush(); }
+};
+
+/**************************************************************************************
+ * STATIC MEMBER DEFINITION
+ **************************************************************************************/
+
+template <typename... Sentences>
+util::Formatter constexpr NmeaDecoder<Sentences...>::FORMATTERS[];
+
+template <typename... Sentences>
+util::DispatchTable constexpr NmeaDecoder<Sentences...>::DISPATCH_TABLE;
+
+template <typename... Sentences>
+uint8_t constexpr NmeaDecoder<Sentences...>::GSV_ENTRY;
+
+template <typename... Sentences>
+typename NmeaDecoder<Sentences...>::SentenceHandler const NmeaDecoder<Sentences...>::SENTENCE_HANDLERS[sizeof...(Sentences)] =
+{
+  &NmeaDecoder<Sentences...>::template parseSentence<Sentences>...
+};
+
+template <typename... Sentences>
+typename NmeaDecoder<Sentences...>::FieldHandler const NmeaDecoder<Sentences...>::FIELD_HANDLERS[sizeof...(Sentences)] =
+{
+  &NmeaDecoder<Sentences...>::template parseField<Sentences>...
+};
+
+template <typename... Sentences>
+typename NmeaDecoder<Sentences...>::CommitHandler const NmeaDecoder<Sentences...>::COMMIT_HANDLERS[sizeof...(Sentences)] =
+{
+  &NmeaDecoder<Sentences...>::template commitSentence<Sentences>...
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_NMEA_DECODER_H_ */
@@ -6,13 +6,12 @@
  */
 
 /**************************************************************************************
- * INCLUDES
+ * INCLUDE
  **************************************************************************************/
 
-#include "gga.h"
+#include "NmeaFramer.h"
 
 #include <string.h>
-#include <stdlib.h>
 
 /**************************************************************************************
  * NAMESPACE
@@ -21,48 +20,42 @@
 namespace nmea
 {
 
-namespace util
-{
-
 /**************************************************************************************
  * FUNCTION DEFINITION
  **************************************************************************************/
 
-bool gga_isGPGGA(char const * nmea)
+namespace detail
 {
-  return (strncmp(nmea, "$GPGGA", 6) == 0);
-}
 
-bool gga_isGLGGA(char const * nmea)
+size_t nmeaBodyLength(char const * buf, size_t len)
 {
-  return (strncmp(nmea, "$GLGGA", 6) == 0);
-}
+  static char const FRAMING_CHARS[] = {'*', '$', '\r', '\n'};
 
-bool gga_isGAGGA(char const * nmea)
-{
-  return (strncmp(nmea, "$GAGGA", 6) == 0);
-}
+  for (char const c : FRAMING_CHARS)
+  {
+    char const * framing_char = static_cast<char const *>(memchr(buf, c, len));
+    if (framing_char)
+      len = framing_char - buf;
+  }
 
-bool gga_isGNGGA(char const * nmea)
-{
-  return (strncmp(nmea, "$GNGGA", 6) == 0);
+  return len;
 }
 
-bool rmc_isBDGGA(char const * nmea)
+size_t nmeaFieldLength(char const * buf, size_t len)
 {
-  return (strncmp(nmea, "$BDGGA", 6) == 0);
-}
+  len = nmeaBodyLength(buf, len);
 
+  char const * field_end = static_cast<char const *>(memchr(buf, ',', len));
+  if (field_end)
+    len = field_end - buf;
 
-bool gga_isGxGGA(char const * nmea)
-{
-  return (gga_isGPGGA(nmea) || gga_isGLGGA(nmea) || gga_isGAGGA(nmea) || gga_isGNGGA(nmea) || rmc_isBDGGA(nmea));
+  return len;
 }
 
+} /* detail */
+
 /**************************************************************************************
  * NAMESPACE
  **************************************************************************************/
 
-} /* util */
-
 } /* nmea */
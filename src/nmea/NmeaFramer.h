@@ -0,0 +1,512 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_NMEA_FRAMER_H_
+#define ARDUINO_NMEA_NMEA_FRAMER_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#undef max
+#undef min
+#include <algorithm>
+
+#include "Types.h"
+#include "util/field.h"
+#include "util/checksum.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+/* The NMEA standard limits messages to 82 characters, one more
+ * character is needed for the '\0' terminator.
+ */
+static size_t constexpr DEFAULT_PARSE_BUFFER_SIZE = 82 + 1;
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* Field and Discarded are only reported once enabled via
+ * NmeaFramer::reportFields().
+ */
+enum class FramerEvent { None, Message, ChecksumError, Overflow, Field, Discarded };
+
+/**************************************************************************************
+ * FUNCTION DECLARATION
+ **************************************************************************************/
+
+namespace detail
+{
+
+/* Determine the number of characters at the start of 'buf'
+ * which belong to the body of a NMEA message, i.e. which
+ * can not alter the state of the framing state machine.
+ */
+size_t nmeaBodyLength(char const * buf, size_t len);
+
+/* Same as nmeaBodyLength but additionally stops at the ','
+ * terminating the current field.
+ */
+size_t nmeaFieldLength(char const * buf, size_t len);
+
+} /* detail */
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Extracts complete NMEA messages with a valid checksum from
+ * a stream of characters. It does not know anything about the
+ * individual NMEA messages and is shared by all parsers.
+ *
+ * PARSE_BUFFER_SIZE limits the length of accepted NMEA messages
+ * to PARSE_BUFFER_SIZE - 1 characters including the trailing
+ * "\r\n", longer messages are discarded.
+ */
+template <size_t PARSE_BUFFER_SIZE = DEFAULT_PARSE_BUFFER_SIZE>
+class NmeaFramer
+{
+
+public:
+
+  static_assert(PARSE_BUFFER_SIZE <= 256, "nmea::util::Field can only address messages of up to 256 characters");
+  static_assert(PARSE_BUFFER_SIZE >= 12, "The parse buffer needs to hold at least a message id, the checksum and \"\\r\\n\"");
+
+
+  NmeaFramer()
+  : _framing_state{FramingState::Idle}
+  , _parser_buf{0}
+  , _parser_buf_elems{0}
+  , _in_place_message{nullptr}
+  , _checksum{0}
+  , _checksum_received{0}
+  , _discarded_bytes{0}
+  , _receive_time(INVALID_RECEIVE_TIME)
+  , _report_fields{false}
+  , _is_reporting_fields{false}
+  , _field_start{0}
+  , _field_number{0}
+  , _field{0, 0}
+  { }
+
+
+  /* Once enabled encode() additionally returns FramerEvent::Field
+   * every time a field of the message being received is complete,
+   * i.e. on its trailing ',' or '*', and FramerEvent::Discarded
+   * when a partially received message is dropped for any other
+   * reason than an overflow. Fields are reported starting with
+   * the next NMEA message.
+   */
+  inline void reportFields(bool const enable) { _report_fields = enable; }
+
+
+  /* Returns FramerEvent::Message as soon as a complete NMEA message
+   * has been received, the message is then accessible via
+   * message() until the next call to encode(). ChecksumError and
+   * Overflow report NMEA messages which have been dropped.
+   *
+   * 'timestamp' denotes the arrival of 'c', the timestamps of
+   * the '$' and the '\n' are available via receiveTime().
+   */
+  FramerEvent encode(char const c, uint32_t const timestamp = 0)
+  {
+    /* Restart framing every time we encounter a '$' sign.
+     * This way the parser buffer always starts with a valid
+     * NMEA message.
+     */
+    if (c == '$')
+    {
+      bool const is_restart = (_framing_state != FramingState::Idle);
+      if (is_restart)
+        discardParserBuffer();
+      addToParserBuffer(c);
+      _in_place_message = nullptr;
+      _checksum = 0;
+      _field_start = 0;
+      _field_number = 0;
+      _is_reporting_fields = _report_fields;
+      _receive_time.first_byte = timestamp;
+      _framing_state = FramingState::Body;
+      return (is_restart && _report_fields) ? FramerEvent::Discarded : FramerEvent::None;
+    }
+
+    /* Discard everything until the start of the next
+     * NMEA message has been detected.
+     */
+    if (_framing_state == FramingState::Idle)
+    {
+      _discarded_bytes++;
+      return FramerEvent::None;
+    }
+
+    /* Messages exceeding the parse buffer are dropped as a whole
+     * and framing resumes with the next '$'. Since every '$'
+     * restarts framing the buffer never contains the start of
+     * another message which could be salvaged.
+     */
+    if (isParseBufferFull())
+    {
+      _discarded_bytes++;
+      discardParserBuffer();
+      return FramerEvent::Overflow;
+    }
+
+    addToParserBuffer(c);
+
+    /* Each state of the framing state machine only looks at
+     * the current character, therefore the cost per received
+     * character is constant regardless of the message length.
+     * The checksum is accumulated along the way so that it is
+     * readily available once the message is complete.
+     */
+    switch (_framing_state)
+    {
+    case FramingState::Body:
+      if (c == '*') {
+        _framing_state = FramingState::ChecksumHi;
+        if (_is_reporting_fields)
+          return completeField();
+      }
+      else if (c == '\r' || c == '\n')
+        return discardPartialMessage();
+      else {
+        _checksum ^= static_cast<uint8_t>(c);
+        if (c == ',' && _is_reporting_fields)
+          return completeField();
+      }
+      break;
+    case FramingState::ChecksumHi:
+    {
+      uint8_t const nibble = util::hexDigitToNibble(c);
+      if (nibble != util::INVALID_HEX_DIGIT) {
+        _checksum_received = (nibble << 4);
+        _framing_state = FramingState::ChecksumLo;
+      }
+      else
+        return discardPartialMessage();
+    }
+    break;
+    case FramingState::ChecksumLo:
+    {
+      uint8_t const nibble = util::hexDigitToNibble(c);
+      if (nibble != util::INVALID_HEX_DIGIT) {
+        _checksum_received |= nibble;
+        _framing_state = FramingState::CarriageReturn;
+      }
+      else
+        return discardPartialMessage();
+    }
+    break;
+    case FramingState::CarriageReturn:
+      if (c == '\r') _framing_state = FramingState::LineFeed;
+      else           return discardPartialMessage();
+      break;
+    case FramingState::LineFeed:
+      if (c == '\n') {
+        _receive_time.last_byte = timestamp;
+        return processNmeaMessage();
+      }
+      else
+        return discardPartialMessage();
+      break;
+    case FramingState::Idle:
+      break;
+    }
+
+    return FramerEvent::None;
+  }
+
+  /* Consumes characters from 'buf' until either all characters
+   * have been consumed or an event occurs. The number of consumed
+   * characters is stored in 'consumed'. All characters share
+   * the same 'timestamp', i.e. the arrival of the chunk.
+   */
+  FramerEvent encode(char const * buf, size_t const len, size_t & consumed, uint32_t const timestamp = 0)
+  {
+    char const * const buf_start = buf;
+    char const * const buf_end = buf + len;
+
+    while (buf < buf_end)
+    {
+      if (_framing_state == FramingState::Idle)
+      {
+        /* Skip everything until the start of the next NMEA
+         * message in one go.
+         */
+        char const * const start = static_cast<char const *>(memchr(buf, '$', buf_end - buf));
+        _discarded_bytes += (start ? start : buf_end) - buf;
+        if (!start)
+          break;
+        buf = start;
+      }
+      else if (_framing_state == FramingState::Body)
+      {
+        /* Copy the whole run of message body characters until
+         * the next character relevant for framing at once.
+         */
+        size_t const max_len = std::min(static_cast<size_t>(buf_end - buf), parseBufferSpace());
+        size_t const body_len = _is_reporting_fields ? detail::nmeaFieldLength(buf, max_len) : detail::nmeaBodyLength(buf, max_len);
+        if (body_len > 0)
+        {
+          memcpy(_parser_buf + _parser_buf_elems, buf, body_len);
+          _parser_buf_elems += body_len;
+          _checksum = util::updateChecksum(_checksum, buf, body_len);
+          buf += body_len;
+          continue;
+        }
+      }
+
+      /* All framing relevant characters are processed by the
+       * per-character state machine.
+       */
+      FramerEvent const event = encode(*buf, timestamp);
+      buf++;
+
+      if (event != FramerEvent::None)
+      {
+        consumed = buf - buf_start;
+        return event;
+      }
+    }
+
+    consumed = len;
+    return FramerEvent::None;
+  }
+
+  /* Same as encode(buf, len, consumed, timestamp) but NMEA messages
+   * which are entirely contained within 'buf' are framed in place,
+   * message() then points into 'buf' and the message is not copied.
+   * Only messages extending beyond 'buf', e.g. across the wrap point
+   * of a circular DMA buffer, are copied into the parse buffer. Once
+   * field reporting is enabled all messages are copied.
+   */
+  FramerEvent encodeInPlace(char const * buf, size_t const len, size_t & consumed, uint32_t const timestamp = 0)
+  {
+    char const * const buf_start = buf;
+    char const * const buf_end = buf + len;
+
+    while (buf < buf_end)
+    {
+      if (_framing_state == FramingState::Idle && !_report_fields)
+      {
+        char const * const start = static_cast<char const *>(memchr(buf, '$', buf_end - buf));
+        _discarded_bytes += (start ? start : buf_end) - buf;
+        if (!start)
+          break;
+        buf = start;
+
+        FramerEvent event = FramerEvent::None;
+        size_t const processed = frameInPlace(buf, buf_end - buf, event, timestamp);
+        buf += processed;
+        if (event != FramerEvent::None)
+        {
+          consumed = buf - buf_start;
+          return event;
+        }
+        if (processed > 0)
+          continue;
+      }
+
+      /* The copying state machine takes over until the end of the
+       * message, framing in place resumes once it is idle again.
+       */
+      size_t copied = 0;
+      FramerEvent const event = encode(buf, buf_end - buf, copied, timestamp);
+      buf += copied;
+
+      if (event != FramerEvent::None)
+      {
+        consumed = buf - buf_start;
+        return event;
+      }
+    }
+
+    consumed = len;
+    return FramerEvent::None;
+  }
+
+  /* The NMEA message, e.g. "$GPRMC,......*CA\r\n", it is '\0'
+   * terminated unless it has been framed in place.
+   */
+  inline char const * message() const { return (_in_place_message != nullptr) ? _in_place_message : _parser_buf; }
+
+  /* Timestamps of the first and the last character of message(). */
+  inline ReceiveTime const & receiveTime() const { return _receive_time; }
+
+  /* The field reported by the last FramerEvent::Field, located
+   * within message(), and its position within the message, the
+   * message id, e.g. "$GPRMC", being field 0.
+   */
+  inline util::Field const & field() const { return _field; }
+  inline size_t fieldNumber() const { return _field_number - 1; }
+
+  /* Number of received characters which did not belong to a
+   * complete NMEA message, e.g. noise or truncated messages.
+   * The counter wraps around after 2^32 characters.
+   */
+  inline uint32_t discardedBytes() const { return _discarded_bytes; }
+
+
+private:
+
+  enum class FramingState : int
+  {
+    Idle,
+    Body,
+    ChecksumHi,
+    ChecksumLo,
+    CarriageReturn,
+    LineFeed
+  };
+
+  FramingState _framing_state;
+  char _parser_buf[PARSE_BUFFER_SIZE];
+  size_t _parser_buf_elems;
+  char const * _in_place_message;
+  uint8_t _checksum;
+  uint8_t _checksum_received;
+  uint32_t _discarded_bytes;
+  ReceiveTime _receive_time;
+  bool _report_fields;
+  bool _is_reporting_fields;
+  size_t _field_start;
+  size_t _field_number;
+  util::Field _field;
+
+  inline bool isParseBufferFull() const { return (_parser_buf_elems >= (PARSE_BUFFER_SIZE - 1)); }
+  inline size_t parseBufferSpace() const { return ((PARSE_BUFFER_SIZE - 1) - _parser_buf_elems); }
+
+  inline void addToParserBuffer(char const c)
+  {
+    _parser_buf[_parser_buf_elems] = c;
+    _parser_buf_elems++;
+  }
+
+  inline void flushParserBuffer()
+  {
+    _parser_buf_elems = 0;
+    _framing_state = FramingState::Idle;
+  }
+
+  inline void discardParserBuffer()
+  {
+    _discarded_bytes += _parser_buf_elems;
+    flushParserBuffer();
+  }
+
+  /* Attempts to frame the message starting with the '$' at 'buf'
+   * without copying it and returns the number of processed
+   * characters. 'event' is set once a complete message has been
+   * framed. 0 is returned if the message needs to be handed over
+   * to the copying state machine, i.e. if it extends beyond 'buf'.
+   * Messages of more than PARSE_BUFFER_SIZE - 1 characters are
+   * never framed in place so that they are rejected as overflow
+   * just like copied messages.
+   */
+  size_t frameInPlace(char const * buf, size_t const len, FramerEvent & event, uint32_t const timestamp)
+  {
+    static size_t constexpr CHECKSUM_AND_CRLF_LEN = 5; /* "*CA\r\n" */
+
+    size_t const max_len = std::min(len, PARSE_BUFFER_SIZE - 1);
+    size_t const body_len = 1 + detail::nmeaBodyLength(buf + 1, max_len - 1);
+
+    /* Truncated messages are discarded in the same way as by
+     * encode(), a '\r' or '\n' within the body is discarded with
+     * the message, a '$' starts the next message.
+     */
+    if (body_len < max_len && buf[body_len] != '*')
+    {
+      size_t const discarded = (buf[body_len] == '$') ? body_len : (body_len + 1);
+      _discarded_bytes += discarded;
+      return discarded;
+    }
+
+    if ((body_len + CHECKSUM_AND_CRLF_LEN) > max_len)
+      return 0;
+
+    uint8_t const hi = util::hexDigitToNibble(buf[body_len + 1]);
+    uint8_t const lo = util::hexDigitToNibble(buf[body_len + 2]);
+    if (hi == util::INVALID_HEX_DIGIT || lo == util::INVALID_HEX_DIGIT || buf[body_len + 3] != '\r' || buf[body_len + 4] != '\n')
+      return 0;
+
+    _in_place_message = buf;
+    _receive_time.first_byte = timestamp;
+    _receive_time.last_byte = timestamp;
+
+    uint8_t const checksum = util::updateChecksum(0, buf + 1, body_len - 1);
+    event = (checksum == ((hi << 4) | lo)) ? FramerEvent::Message : FramerEvent::ChecksumError;
+    return body_len + CHECKSUM_AND_CRLF_LEN;
+  }
+
+  inline FramerEvent discardPartialMessage()
+  {
+    discardParserBuffer();
+    return _report_fields ? FramerEvent::Discarded : FramerEvent::None;
+  }
+
+  /* Called after the character terminating the field has
+   * been added to the parser buffer.
+   */
+  inline FramerEvent completeField()
+  {
+    size_t const field_end = _parser_buf_elems - 1;
+    _field.offset = static_cast<uint8_t>(_field_start);
+    _field.length = static_cast<uint8_t>(field_end - _field_start);
+    _field_start = field_end + 1;
+    _field_number++;
+    return FramerEvent::Field;
+  }
+
+  inline void terminateParserBuffer()
+  {
+    addToParserBuffer('\0');
+  }
+
+  FramerEvent processNmeaMessage()
+  {
+    /* At this point a complete NMEA message is stored
+     * in the parser buffer and a 0 termination is added
+     * to allow the usage of string library functions on
+     * the buffer.
+     */
+    terminateParserBuffer();
+
+    /* The message itself remains in the parser buffer until
+     * the start of the next message overwrites it, so that it
+     * can be decoded after returning from encode().
+     */
+    flushParserBuffer();
+
+    /* Verify if the checksum of the NMEA message is correct. */
+    if (_checksum != _checksum_received)
+      return FramerEvent::ChecksumError;
+
+    return FramerEvent::Message;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_NMEA_FRAMER_H_ */
@@ -0,0 +1,251 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_NMEA_PARSER_H_
+#define ARDUINO_NMEA_NMEA_PARSER_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "Types.h"
+#include "GxRMC.h"
+#include "GxGGA.h"
+#include "GxGSV.h"
+#include "GxGSA.h"
+#include "NmeaFramer.h"
+#include "NmeaDecoder.h"
+#include "Profiling.h"
+#include "Statistics.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Frames the received characters via a NmeaFramer and hands the
+ * NMEA messages over to 'Decoder', i.e. NmeaDecoder<...> or a
+ * class derived from it. PARSE_BUFFER_SIZE limits the length of
+ * accepted NMEA messages to PARSE_BUFFER_SIZE - 1 characters.
+ */
+template <size_t PARSE_BUFFER_SIZE, typename Decoder>
+class FramedDecoder : public Decoder
+{
+
+public:
+
+  using Decoder::Decoder;
+
+
+  /* 'timestamp' denotes the arrival of the characters, e.g. in
+   * cycles or microseconds, and is handed over as the 'received'
+   * member of the decoded data. Without it the characters are
+   * stamped via the timestamp source if profiling is enabled.
+   */
+  inline void encode(char const c) { encode(c, this->timestamp()); }
+
+  void encode(char const c, uint32_t const timestamp)
+  {
+#if NMEA_PARSER_ENABLE_STATISTICS
+    this->countReceivedBytes(1);
+#endif
+#if NMEA_PARSER_ENABLE_PROFILING
+    uint32_t const start = this->timestamp();
+    FramerEvent const event = _framer.encode(c, timestamp);
+    this->recordFraming(this->timestamp() - start);
+    notify(event);
+#else
+    notify(_framer.encode(c, timestamp));
+#endif
+  }
+
+  inline void encode(char const * buf, size_t const len) { encode(buf, len, this->timestamp()); }
+
+  void encode(char const * buf, size_t const len, uint32_t const timestamp)
+  {
+#if NMEA_PARSER_ENABLE_STATISTICS
+    this->countReceivedBytes(len);
+#endif
+    char const * const buf_end = buf + len;
+
+    while (buf < buf_end)
+    {
+      size_t consumed = 0;
+#if NMEA_PARSER_ENABLE_PROFILING
+      uint32_t const start = this->timestamp();
+#endif
+      FramerEvent const event = _framer.encode(buf, buf_end - buf, consumed, timestamp);
+#if NMEA_PARSER_ENABLE_PROFILING
+      this->recordFraming(this->timestamp() - start);
+#endif
+      buf += consumed;
+      notify(event);
+    }
+  }
+
+  inline void encode(uint8_t const * buf, size_t const len) { encode(reinterpret_cast<char const *>(buf), len); }
+  inline void encode(uint8_t const * buf, size_t const len, uint32_t const timestamp) { encode(reinterpret_cast<char const *>(buf), len, timestamp); }
+
+  /* Ingests the characters of a circular buffer, e.g. the receive
+   * buffer of a UART served by circular DMA, from 'tail' up to but
+   * excluding 'head'. NMEA messages are framed in place and only
+   * copied into the parse buffer when they straddle the wrap point
+   * or the end of the available characters. The caller advances
+   * its tail to 'head' afterwards, all characters are consumed.
+   */
+  inline void encodeRing(char const * ring, size_t const ring_size, size_t const tail, size_t const head) { encodeRing(ring, ring_size, tail, head, this->timestamp()); }
+
+  void encodeRing(char const * ring, size_t const ring_size, size_t const tail, size_t const head, uint32_t const timestamp)
+  {
+    if (head >= tail)
+      encodeSegments(ring + tail, head - tail, nullptr, 0, timestamp);
+    else
+      encodeSegments(ring + tail, ring_size - tail, ring, head, timestamp);
+  }
+
+  inline void encodeRing(uint8_t const * ring, size_t const ring_size, size_t const tail, size_t const head) { encodeRing(reinterpret_cast<char const *>(ring), ring_size, tail, head); }
+  inline void encodeRing(uint8_t const * ring, size_t const ring_size, size_t const tail, size_t const head, uint32_t const timestamp) { encodeRing(reinterpret_cast<char const *>(ring), ring_size, tail, head, timestamp); }
+
+  /* Same as encodeRing() for two contiguous segments, 'second'
+   * continuing where 'first' ends, e.g. both halves of a DMA
+   * buffer within the half- and full-transfer interrupts.
+   */
+  inline void encodeSegments(char const * first, size_t const first_len, char const * second, size_t const second_len) { encodeSegments(first, first_len, second, second_len, this->timestamp()); }
+
+  void encodeSegments(char const * first, size_t const first_len, char const * second, size_t const second_len, uint32_t const timestamp)
+  {
+    encodeInPlace(first, first_len, timestamp);
+    encodeInPlace(second, second_len, timestamp);
+  }
+
+
+  /* Opt-in early dispatch: every field is decoded as soon as its
+   * trailing ',' arrives and the provisional callback of a RMC/GGA
+   * message is invoked once its time and once its position are
+   * available, i.e. long before its checksum has been received.
+   * The provisional data carries the first_byte receive timestamp
+   * only. The verdict callback reports whether the checksum
+   * confirmed the provisional data, followed by the regular update
+   * callback, or whether the message has been retracted, e.g. due
+   * to a checksum error. Passing nullptr for all callbacks disables
+   * the early dispatch again.
+   */
+  template <typename Sentence>
+  void onProvisional(typename detail::SentenceSlot<Sentence>::ProvisionalCallback callback)
+  {
+    this->template setProvisionalCallback<Sentence>(callback);
+    _framer.reportFields(this->needsFields());
+  }
+
+  void onVerdict(VerdictCallback const callback)
+  {
+    this->setVerdictCallback(callback);
+    _framer.reportFields(this->needsFields());
+  }
+
+  /* Opt-in streaming decode: all fields are decoded one by one
+   * as their trailing ',' or '*' arrives instead of decoding the
+   * whole message at once after its '\n'. This bounds the cost of
+   * every single encode() call by the cost of decoding a single
+   * field, which is favourable for hard real-time loops. The
+   * decoded data and the update callbacks are the same in either
+   * mode.
+   */
+  void setStreamingDecode(bool const enable)
+  {
+    this->setStreaming(enable);
+    _framer.reportFields(this->needsFields());
+  }
+
+
+  /* Provides access to the raw text of the NMEA message which
+   * is currently being decoded, e.g. "$GPRMC,......*CA\r\n".
+   * Only valid within the update callbacks. Messages framed in
+   * place by encodeRing()/encodeSegments() are not '\0' terminated
+   * but end with the "\r\n".
+   */
+  inline char const * sentence() const { return _framer.message(); }
+
+  /* Number of received characters which did not belong to a
+   * complete NMEA message, e.g. noise or truncated messages.
+   */
+  inline uint32_t discardedBytes() const { return _framer.discardedBytes(); }
+
+#if NMEA_PARSER_ENABLE_STATISTICS
+  inline Statistics statistics() const { return Decoder::statistics(_framer.discardedBytes()); }
+#endif
+
+
+private:
+
+  NmeaFramer<PARSE_BUFFER_SIZE> _framer;
+
+  void encodeInPlace(char const * buf, size_t const len, uint32_t const timestamp)
+  {
+#if NMEA_PARSER_ENABLE_STATISTICS
+    this->countReceivedBytes(len);
+#endif
+    char const * const buf_end = buf + len;
+
+    while (buf < buf_end)
+    {
+      size_t consumed = 0;
+#if NMEA_PARSER_ENABLE_PROFILING
+      uint32_t const start = this->timestamp();
+#endif
+      FramerEvent const event = _framer.encodeInPlace(buf, buf_end - buf, consumed, timestamp);
+#if NMEA_PARSER_ENABLE_PROFILING
+      this->recordFraming(this->timestamp() - start);
+#endif
+      buf += consumed;
+      notify(event);
+    }
+  }
+
+  inline void notify(FramerEvent const event)
+  {
+    if (event == FramerEvent::Field)
+      this->onFramerField(_framer.message(), _framer.field(), _framer.fieldNumber(), _framer.receiveTime());
+    else
+      this->onFramerEvent(event, _framer.message(), _framer.receiveTime());
+  }
+};
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* NMEA parser supporting only the NMEA messages listed as
+ * template parameters, e.g. NmeaParser<Rmc> or NmeaParser<Rmc, Gga>,
+ * see NmeaDecoder.
+ *
+ * BasicNmeaParser additionally allows to select the size of the
+ * parse buffer, e.g. BasicNmeaParser<128, Rmc> in order to accept
+ * NMEA messages exceeding the standard length of 82 characters.
+ */
+template <size_t PARSE_BUFFER_SIZE, typename... Sentences>
+using BasicNmeaParser = FramedDecoder<PARSE_BUFFER_SIZE, NmeaDecoder<Sentences...>>;
+
+template <typename... Sentences>
+using NmeaParser = BasicNmeaParser<DEFAULT_PARSE_BUFFER_SIZE, Sentences...>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_NMEA_PARSER_H_ */
@@ -5,14 +5,11 @@
  * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
  */
 
-#ifndef ARDUINO_NMEA_UTIL_GGA_H_
-#define ARDUINO_NMEA_UTIL_GGA_H_
-
 /**************************************************************************************
- * INCLUDES
+ * INCLUDE
  **************************************************************************************/
 
-#include "../Types.h"
+#include "Profiling.h"
 
 /**************************************************************************************
  * NAMESPACE
@@ -21,26 +18,39 @@
 namespace nmea
 {
 
-namespace util
-{
-
 /**************************************************************************************
- * FUNCTION DECLARATION
+ * FUNCTION DEFINITION
  **************************************************************************************/
 
-bool  gga_isGPGGA(char const * nmea);
-bool  gga_isGLGGA(char const * nmea);
-bool  gga_isGAGGA(char const * nmea);
-bool  gga_isGNGGA(char const * nmea);
-bool  rmc_isBDGGA(char const * nmea);
-bool  gga_isGxGGA(char const * nmea);
+void record(StageProfile & profile, uint32_t const duration)
+{
+  if (profile.count == 0 || duration < profile.min) profile.min = duration;
+  if (profile.count == 0 || duration > profile.max) profile.max = duration;
+
+  profile.count++;
+  profile.sum += duration;
+
+  size_t bin = 0;
+  for (uint32_t d = duration; d != 0 && bin < (NUM_PROFILE_HISTOGRAM_BINS - 1); d >>= 1)
+    bin++;
+  profile.histogram[bin]++;
+}
+
+uint32_t average(StageProfile const & profile)
+{
+  if (profile.count == 0)
+    return 0;
+
+  return static_cast<uint32_t>(profile.sum / profile.count);
+}
+
+uint32_t noTimestamp()
+{
+  return 0;
+}
 
 /**************************************************************************************
  * NAMESPACE
  **************************************************************************************/
 
-} /* util */
-
 } /* nmea */
-
-#endif /* ARDUINO_NMEA_UTIL_GGA_H_ */
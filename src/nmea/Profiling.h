@@ -0,0 +1,102 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_PROFILING_H_
+#define ARDUINO_NMEA_PROFILING_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+
+/* Set to 1 in order to measure the time spent within each stage
+ * of the parsers via a user supplied timestamp source. When set
+ * to 0 neither the measurements nor their storage is compiled.
+ * Must be set for all translation units alike, i.e. via the
+ * build flags, see ArduinoNmeaParser.h.
+ */
+#ifndef NMEA_PARSER_ENABLE_PROFILING
+#  define NMEA_PARSER_ENABLE_PROFILING 0
+#endif
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+/* Bin i counts durations of i significant bits, i.e. [2^(i-1), 2^i),
+ * the last bin additionally counts all longer durations.
+ */
+static size_t constexpr NUM_PROFILE_HISTOGRAM_BINS = 16;
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* Returns a free running timestamp, e.g. the DWT cycle counter
+ * on Cortex-M or clock_gettime() on the host. Wrap arounds are
+ * handled as long as a single stage takes less than 2^32 ticks.
+ */
+typedef uint32_t (*TimestampSource)();
+
+typedef struct
+{
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t sum;
+  uint32_t histogram[NUM_PROFILE_HISTOGRAM_BINS];
+} StageProfile;
+
+typedef struct
+{
+  StageProfile field_index;
+  StageProfile dispatch;
+  StageProfile decode;
+  StageProfile callback;
+  /* From the '\n' until invoking the callback, based on the
+   * timestamps handed to encode().
+   */
+  StageProfile latency;
+} SentenceProfile;
+
+/* Profile of a parser supporting NUM_SENTENCES NMEA messages,
+ * sentence[NUM_SENTENCES] covers all NMEA messages which are
+ * not decoded.
+ */
+template <size_t NUM_SENTENCES>
+struct Profile
+{
+  StageProfile framing;
+  SentenceProfile sentence[NUM_SENTENCES + 1];
+};
+
+/**************************************************************************************
+ * FUNCTION DECLARATION
+ **************************************************************************************/
+
+void     record (StageProfile & profile, uint32_t const duration);
+uint32_t average(StageProfile const & profile);
+
+/* Default timestamp source, always returns 0. */
+uint32_t noTimestamp();
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_PROFILING_H_ */
@@ -0,0 +1,186 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "SkyView.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * CTOR/DTOR
+ **************************************************************************************/
+
+SkyViewAssembler::SkyViewAssembler(OnSkyViewCallback on_sky_view, void * context)
+: _on_sky_view{on_sky_view}
+, _context{context}
+, _sky_view{}
+, _sequence{}
+, _is_empty{true}
+, _sequence_gaps{0}
+{
+  clear();
+}
+
+/**************************************************************************************
+ * PUBLIC MEMBER FUNCTIONS
+ **************************************************************************************/
+
+void SkyViewAssembler::add(GsvData const & gsv)
+{
+  Constellation constellation;
+  if (!toConstellation(gsv.source, constellation))
+    return;
+
+  if (gsv.num_messages < 1 || gsv.message_number < 1 || gsv.message_number > gsv.num_messages)
+    return;
+
+  ConstellationView & view = _sky_view.constellation[static_cast<size_t>(constellation)];
+  Sequence & sequence = _sequence[static_cast<size_t>(constellation)];
+
+  if (gsv.message_number == 1)
+  {
+    if (sequence.next_message != 0 && !sequence.is_skipped)
+      _sequence_gaps++;
+
+    /* The same signal of a constellation which is already
+     * complete can only stem from the next epoch.
+     */
+    if (view.is_valid)
+    {
+      if (view.signal_id != gsv.signal_id)
+      {
+        sequence = Sequence{(gsv.num_messages > 1) ? 2 : 0, gsv.num_messages, gsv.num_messages > 1};
+        return;
+      }
+      flush();
+    }
+
+    begin(view, sequence, gsv);
+  }
+  else if (sequence.is_skipped)
+  {
+    if (gsv.message_number == gsv.num_messages)
+      sequence = Sequence{0, 0, false};
+    return;
+  }
+  else if (gsv.message_number != sequence.next_message || gsv.num_messages != sequence.num_messages)
+  {
+    _sequence_gaps++;
+    drop(view, sequence, gsv);
+    return;
+  }
+
+  for (size_t s = 0; s < gsv.num_entries && view.num_entries < MAX_SATELLITES_PER_CONSTELLATION; s++)
+    view.satellite[view.num_entries++] = gsv.satellite[s];
+
+  if (gsv.message_number == gsv.num_messages)
+  {
+    view.is_valid = true;
+    sequence = Sequence{0, 0, false};
+    _sky_view.received.last_byte = gsv.received.last_byte;
+  }
+  else
+    sequence.next_message++;
+}
+
+void SkyViewAssembler::flush()
+{
+  for (size_t c = 0; c < NUM_CONSTELLATIONS; c++)
+  {
+    Sequence & sequence = _sequence[c];
+    if (sequence.next_message != 0 && !sequence.is_skipped)
+    {
+      _sequence_gaps++;
+      _sky_view.constellation[c].num_entries = 0;
+    }
+    sequence = Sequence{0, 0, false};
+  }
+
+  if (_is_empty)
+    return;
+
+  bool is_complete = false;
+  for (size_t c = 0; c < NUM_CONSTELLATIONS; c++)
+    is_complete = is_complete || _sky_view.constellation[c].is_valid;
+
+  if (is_complete)
+    publish();
+  else
+    clear();
+}
+
+/**************************************************************************************
+ * PRIVATE MEMBER FUNCTIONS
+ **************************************************************************************/
+
+void SkyViewAssembler::publish()
+{
+  if (_on_sky_view)
+    _on_sky_view(_sky_view, _context);
+
+  clear();
+}
+
+void SkyViewAssembler::clear()
+{
+  for (size_t c = 0; c < NUM_CONSTELLATIONS; c++)
+  {
+    ConstellationView & view = _sky_view.constellation[c];
+    view.is_valid = false;
+    view.num_satellites = -1;
+    view.signal_id = -1;
+    view.num_entries = 0;
+  }
+  _sky_view.received = INVALID_RECEIVE_TIME;
+  _is_empty = true;
+}
+
+void SkyViewAssembler::begin(ConstellationView & view, Sequence & sequence, GsvData const & gsv)
+{
+  if (_is_empty)
+  {
+    _sky_view.received.first_byte = gsv.received.first_byte;
+    _is_empty = false;
+  }
+
+  view.is_valid = false;
+  view.num_satellites = gsv.num_satellites;
+  view.signal_id = gsv.signal_id;
+  view.num_entries = 0;
+  sequence = Sequence{1, gsv.num_messages, false};
+}
+
+void SkyViewAssembler::drop(ConstellationView & view, Sequence & sequence, GsvData const & gsv)
+{
+  /* A sequence in progress has already overwritten the view,
+   * the remaining GSV messages of the sequence are skipped.
+   */
+  if (sequence.next_message != 0)
+  {
+    view.is_valid = false;
+    view.num_entries = 0;
+  }
+
+  if (gsv.message_number == gsv.num_messages)
+    sequence = Sequence{0, 0, false};
+  else
+    sequence = Sequence{gsv.message_number + 1, gsv.num_messages, true};
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
@@ -0,0 +1,131 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_SKY_VIEW_H_
+#define ARDUINO_NMEA_SKY_VIEW_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "Types.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+/* Capacity of the satellite table of each constellation, any
+ * further satellites in view are not stored.
+ */
+static size_t constexpr MAX_SATELLITES_PER_CONSTELLATION = 20;
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+typedef struct
+{
+  /* True if a complete sequence of GSV messages has been received. */
+  bool is_valid;
+  /* Satellites in view as reported by the receiver. */
+  int num_satellites;
+  /* Signal id of the GSV messages (NMEA 4.10 and later), -1 if not present. */
+  int signal_id;
+  /* Satellites stored within 'satellite'. */
+  size_t num_entries;
+  SatelliteInView satellite[MAX_SATELLITES_PER_CONSTELLATION];
+} ConstellationView;
+
+/* All satellites in view of a single epoch, indexed by Constellation. */
+typedef struct
+{
+  ConstellationView constellation[NUM_CONSTELLATIONS];
+  /* First character of the first and last character of the last GSV message. */
+  ReceiveTime received;
+} SkyView;
+
+typedef void (*OnSkyViewCallback)(SkyView const & sky_view, void * context);
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Assembles the sequences of GSV messages (1/3, 2/3, 3/3) of all
+ * constellations into a single sky view per epoch, which is
+ * handed over to 'on_sky_view' as a whole once the epoch ends:
+ *
+ *   - the first message of a sequence arrives for a constellation
+ *     which is already complete within the current epoch or
+ *   - any other NMEA message arrives, see flush().
+ *
+ * A missing or repeated GSV message drops the sequence of the
+ * affected constellation and is counted by sequenceGaps().
+ * Receivers which report several signals per constellation
+ * (NMEA 4.10 and later) are covered by the first signal per
+ * epoch, the sequences of all further signals are skipped.
+ *
+ *   nmea::SkyViewAssembler sky_view(onSkyView, nullptr);
+ *   parser.setSkyView(&sky_view);
+ */
+class SkyViewAssembler
+{
+
+public:
+
+  SkyViewAssembler(OnSkyViewCallback on_sky_view, void * context);
+
+
+  void add(GsvData const & gsv);
+
+  /* Ends the current epoch: incomplete sequences are dropped and
+   * the sky view is published if any sequence has been completed.
+   * The parser calls it for every NMEA message except GSV.
+   */
+  void flush();
+
+  inline uint32_t sequenceGaps() const { return _sequence_gaps; }
+
+
+private:
+
+  typedef struct
+  {
+    int next_message;   /* 0 if no sequence is in progress */
+    int num_messages;
+    bool is_skipped;
+  } Sequence;
+
+  OnSkyViewCallback _on_sky_view;
+  void * _context;
+  SkyView _sky_view;
+  Sequence _sequence[NUM_CONSTELLATIONS];
+  bool _is_empty;
+  uint32_t _sequence_gaps;
+
+  void publish();
+  void clear();
+  void begin(ConstellationView & view, Sequence & sequence, GsvData const & gsv);
+  void drop(ConstellationView & view, Sequence & sequence, GsvData const & gsv);
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_SKY_VIEW_H_ */
@@ -0,0 +1,165 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_SNAPSHOT_H_
+#define ARDUINO_NMEA_SNAPSHOT_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#undef max
+#undef min
+#include <atomic>
+#include <type_traits>
+
+#include "Types.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Sequence lock publishing the latest value of 'T' from a
+ * single writer to any number of concurrent readers. store()
+ * never waits, load() retries while a store() is in progress
+ * and therefore always returns a consistent copy.
+ *
+ * The value is kept as atomic words so that readers racing
+ * with the writer do not constitute a data race. The words are
+ * stored with release and loaded with acquire semantics, a
+ * reader observing any word of a store() in progress is thus
+ * guaranteed to observe the odd sequence number as well. This
+ * avoids standalone fences which ThreadSanitizer can not check.
+ */
+template <typename T>
+class Snapshot
+{
+
+public:
+
+  static_assert(std::is_trivially_copyable<T>::value, "Snapshot requires a trivially copyable type");
+
+
+  Snapshot(T const & initial)
+  : _sequence{0}
+  {
+    uint32_t words[NUM_WORDS] = {0};
+    memcpy(words, &initial, sizeof(T));
+    for (size_t w = 0; w < NUM_WORDS; w++)
+      _words[w].store(words[w], std::memory_order_relaxed);
+  }
+
+
+  /* Writer side, must not be called concurrently. */
+  void store(T const & value)
+  {
+    uint32_t words[NUM_WORDS] = {0};
+    memcpy(words, &value, sizeof(T));
+
+    /* An odd sequence number marks a store in progress. */
+    uint32_t const sequence = _sequence.load(std::memory_order_relaxed);
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+
+    for (size_t w = 0; w < NUM_WORDS; w++)
+      _words[w].store(words[w], std::memory_order_release);
+
+    _sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  /* Reader side, may be called from any number of threads. */
+  T load() const
+  {
+    uint32_t words[NUM_WORDS];
+    uint32_t before = 0, after = 0;
+
+    do
+    {
+      before = _sequence.load(std::memory_order_acquire);
+      for (size_t w = 0; w < NUM_WORDS; w++)
+        words[w] = _words[w].load(std::memory_order_acquire);
+      after = _sequence.load(std::memory_order_relaxed);
+    } while ((before & 1) || (before != after));
+
+    T value;
+    memcpy(&value, words, sizeof(T));
+    return value;
+  }
+
+  /* Number of completed store() calls, allows readers to
+   * detect whether a new value has been published.
+   */
+  inline uint32_t version() const { return _sequence.load(std::memory_order_acquire) / 2; }
+
+
+private:
+
+  static size_t constexpr NUM_WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+  std::atomic<uint32_t> _sequence;
+  std::atomic<uint32_t> _words[NUM_WORDS];
+};
+
+/* Latest RMC and GGA data published by a parser running in
+ * one thread to readers on other threads or cores, filled via
+ * the update callbacks of the parsers:
+ *
+ *   nmea::LatestFix fix;
+ *   ArduinoNmeaParser parser(nmea::LatestFix::onUpdate<nmea::RmcData>,
+ *                            nmea::LatestFix::onUpdate<nmea::GgaData>,
+ *                            &fix);
+ */
+class LatestFix
+{
+
+public:
+
+  LatestFix()
+  : _rmc(INVALID_RMC)
+  , _gga(INVALID_GGA)
+  { }
+
+
+  inline void store(RmcData const & rmc) { _rmc.store(rmc); }
+  inline void store(GgaData const & gga) { _gga.store(gga); }
+
+  /* Matches the update callbacks of ArduinoNmeaParser and
+   * NmeaParser, 'fix' is the user supplied context.
+   */
+  template <typename Data>
+  static void onUpdate(Data const & data, void * fix) { static_cast<LatestFix *>(fix)->store(data); }
+
+  inline RmcData rmc() const { return _rmc.load(); }
+  inline GgaData gga() const { return _gga.load(); }
+
+  inline Snapshot<RmcData> const & rmcSnapshot() const { return _rmc; }
+  inline Snapshot<GgaData> const & ggaSnapshot() const { return _gga; }
+
+
+private:
+
+  Snapshot<RmcData> _rmc;
+  Snapshot<GgaData> _gga;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_SNAPSHOT_H_ */
@@ -0,0 +1,65 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_STATISTICS_H_
+#define ARDUINO_NMEA_STATISTICS_H_
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "Types.h"
+
+/* Set to 0 in order to remove all statistics counters from
+ * the parsers, neither RAM nor any increments are spent then.
+ * Must be set for all translation units alike, i.e. via the
+ * build flags, see ArduinoNmeaParser.h.
+ */
+#ifndef NMEA_PARSER_ENABLE_STATISTICS
+#  define NMEA_PARSER_ENABLE_STATISTICS 1
+#endif
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+/* Number of values of RmcSource/GgaSource. */
+static size_t constexpr NUM_TALKERS = static_cast<size_t>(RmcSource::QZSS) + 1;
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* All counters wrap around after 2^32 events. */
+typedef struct
+{
+  uint32_t received_bytes;
+  uint32_t discarded_bytes;               /* Not belonging to any complete NMEA message. */
+  uint32_t framed_messages;               /* Complete NMEA messages, including checksum errors. */
+  uint32_t checksum_errors;
+  uint32_t overflows;                     /* NMEA messages exceeding the parse buffer. */
+  uint32_t unknown_messages;              /* Valid NMEA messages which are not decoded. */
+  uint32_t talker_messages[NUM_TALKERS];  /* Valid NMEA messages, indexed by RmcSource. */
+} Statistics;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_STATISTICS_H_ */
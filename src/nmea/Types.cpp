@@ -11,6 +11,8 @@
 
 #include "Types.h"
 
+#include "util/numeric.h"
+
 /**************************************************************************************
  * NAMESPACE
  **************************************************************************************/
@@ -19,10 +21,35 @@ namespace nmea
 {
 
 /**************************************************************************************
- * EXTERN FUNCTION DECLARATION
+ * INTERNAL FUNCTION DEFINITION
  **************************************************************************************/
 
-extern "C" time_t rk_timegm (struct tm *tm);
+static bool isLeapYear(int const year)
+{
+  return (year % 4) == 0 && ((year % 100) != 0 || (year % 400) == 0);
+}
+
+static int daysInMonth(int const year, int const month)
+{
+  static int const DAYS_IN_MONTH[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return DAYS_IN_MONTH[month - 1] + (((month == 2) && isLeapYear(year)) ? 1 : 0);
+}
+
+static time_t toPosixTimestamp(int32_t const epoch_day, Time const & time)
+{
+  int const second = time.second + ((time.microsecond > 500) ? 1 : 0);
+
+  if (epoch_day == INVALID_EPOCH_DAY)
+    return -1;
+  if (time.hour < 0 || time.hour > 23)
+    return -1;
+  if (time.minute < 0 || time.minute > 59)
+    return -1;
+  if (second < 0 || second > 59)
+    return -1;
+
+  return static_cast<time_t>(epoch_day) * 86400 + time.hour * 3600 + time.minute * 60 + second;
+}
 
 /**************************************************************************************
  * PUBLIC FUNCTION DEFINITION
@@ -54,26 +81,91 @@ bool isValid(Date const & date, Time const & time)
   return (isValid(date) && isValid(time));
 }
 
+int32_t toEpochDay(Date const & date)
+{
+  if (date.year < 1970)
+    return INVALID_EPOCH_DAY;
+  if (date.month < 1 || date.month > 12)
+    return INVALID_EPOCH_DAY;
+  if (date.day < 1 || date.day > daysInMonth(date.year, date.month))
+    return INVALID_EPOCH_DAY;
+
+  /* Closed form conversion of a date of the proleptic gregorian
+   * calendar into days since 1970-01-01. The year is shifted to
+   * start in March so that the leap day is the last day of the
+   * year, the day of the year then follows from a linear formula
+   * of the month. See http://howardhinnant.github.io/date_algorithms.html
+   */
+  int32_t const y   = date.year - ((date.month <= 2) ? 1 : 0);
+  int32_t const era = y / 400;
+  int32_t const yoe = y - era * 400;
+  int32_t const doy = (153 * (date.month + ((date.month > 2) ? -3 : 9)) + 2) / 5 + date.day - 1;
+  int32_t const doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+  return era * 146097 + doe - 719468;
+}
+
 time_t toPosixTimestamp(Date const & date, Time const & time)
 {
-  struct tm tm =
+  return toPosixTimestamp(toEpochDay(date), time);
+}
+
+time_t toPosixTimestamp(Date const & date, Time const & time, EpochDayCache & cache)
+{
+  if ((date.day   != cache.date.day)   ||
+      (date.month != cache.date.month) ||
+      (date.year  != cache.date.year))
   {
-    /* tm_sec    */ time.second + ((time.microsecond > 500) ? 1 : 0),
-    /* tm_min    */ time.minute,
-    /* tm_hour   */ time.hour,
-    /* tm_mday   */ date.day,
-    /* tm_mon    */ date.month - 1,
-    /* tm_year   */ date.year - 1900,
-    /* tm_wday   */ 0,
-    /* tm_yday   */ 0,
-    /* tm_isdst  */ 0,
-#ifdef HOST
-    /* tm_gmtoff */ 0,
-    /* tm_zone   */ 0,
-#endif
-  };
-
-  return rk_timegm(&tm);
+    cache.date      = date;
+    cache.epoch_day = toEpochDay(date);
+  }
+
+  return toPosixTimestamp(cache.epoch_day, time);
+}
+
+bool toConstellation(RmcSource const source, Constellation & constellation)
+{
+  switch (source)
+  {
+  case RmcSource::GPS:     constellation = Constellation::GPS;     return true;
+  case RmcSource::GLONASS: constellation = Constellation::GLONASS; return true;
+  case RmcSource::Galileo: constellation = Constellation::Galileo; return true;
+  case RmcSource::BDS:     constellation = Constellation::BDS;     return true;
+  case RmcSource::QZSS:    constellation = Constellation::QZSS;    return true;
+  default:                                                         return false;
+  }
+}
+
+int toSatelliteNumber(int const id)
+{
+  if (id >=   1 && id <=  64) return id;
+  if (id >=  65 && id <=  96) return id - 64;
+  if (id >= 193 && id <= 202) return id - 192;
+  if (id >= 301 && id <= 336) return id - 300;
+  if (id >= 401 && id <= 463) return id - 400;
+  return 0;
+}
+
+bool isActive(GsaData const & gsa, Constellation const constellation, int const id)
+{
+  int const number = toSatelliteNumber(id);
+  if (number == 0)
+    return false;
+
+  return (gsa.active[static_cast<size_t>(constellation)] >> (number - 1)) & 1;
+}
+
+size_t numActive(GsaData const & gsa, Constellation const constellation)
+{
+  return util::popcount(gsa.active[static_cast<size_t>(constellation)]);
+}
+
+size_t numActive(GsaData const & gsa)
+{
+  size_t num_active = 0;
+  for (size_t c = 0; c < NUM_CONSTELLATIONS; c++)
+    num_active += util::popcount(gsa.active[c]);
+  return num_active;
 }
 
 /**************************************************************************************
@@ -14,6 +14,8 @@
 
 #include <time.h>
 #include <math.h>
+#include <stdint.h>
+#include <stddef.h>
 
 /**************************************************************************************
  * NAMESPACE
@@ -41,9 +43,18 @@ typedef struct
   int year;
 } Date;
 
+/* Timestamps supplied to encode() for the '$' and the '\n'
+ * of a NMEA message, in units chosen by the caller.
+ */
+typedef struct
+{
+  uint32_t first_byte;
+  uint32_t last_byte;
+} ReceiveTime;
+
 enum class RmcSource
 {
-  Unknown, GPS, Galileo, GLONASS, GNSS, BDS
+  Unknown, GPS, Galileo, GLONASS, GNSS, BDS, QZSS
 };
 
 typedef struct
@@ -53,10 +64,16 @@ typedef struct
   bool is_valid;
   float latitude;
   float longitude;
+  /* Latitude/longitude in units of 1e-7 degrees, i.e. ~1 cm,
+   * computed directly from the digits of the NMEA message.
+   */
+  int32_t latitude_e7;
+  int32_t longitude_e7;
   float speed;
   float course;
   float magnetic_variation;
   Date date;
+  ReceiveTime received;
 } RmcData;
 
 enum class FixQuality
@@ -72,6 +89,9 @@ typedef struct
   Time time_utc;
   float latitude;
   float longitude;
+  /* Latitude/longitude in units of 1e-7 degrees. */
+  int32_t latitude_e7;
+  int32_t longitude_e7;
   FixQuality fix_quality;
   int num_satellites;
   /* HDOP = Horizontal dilution of position */
@@ -91,25 +111,157 @@ typedef struct
   int dgps_age;
   /* DGPS station id - 4 bytes. */
   char dgps_id[4];
+  ReceiveTime received;
 } GgaData;
 
+/* Satellite systems which are listed separately within GSV and
+ * GSA messages, in contrast to RmcSource there is no GNSS.
+ */
+enum class Constellation
+{
+  GPS, GLONASS, Galileo, BDS, QZSS
+};
+
+static size_t constexpr NUM_CONSTELLATIONS = static_cast<size_t>(Constellation::QZSS) + 1;
+
+typedef RmcSource GsvSource;
+
+/* Maximum number of satellites listed within a single GSV message. */
+static size_t constexpr GSV_MAX_SATELLITES = 4;
+
+/* 6 bytes without padding, the satellites of a constellation
+ * are stored contiguously.
+ */
+typedef struct
+{
+  /* Satellite id, e.g. the PRN for GPS, -1 if unknown. */
+  int16_t id;
+  /* Azimuth 0 - 359 degrees (true), -1 if unknown. */
+  int16_t azimuth;
+  /* Elevation 0 - 90 degrees, -1 if unknown. */
+  int8_t elevation;
+  /* C/N0 in dB-Hz, -1 if the satellite is not tracked. */
+  int8_t snr;
+} SatelliteInView;
+
+/* A single GSV message, i.e. one part of the sequence of GSV
+ * messages listing all satellites in view of a constellation.
+ */
+typedef struct
+{
+  GsvSource source;
+  int num_messages;
+  int message_number;
+  /* Satellites in view of the whole sequence. */
+  int num_satellites;
+  /* Signal id (NMEA 4.10 and later), -1 if not present. */
+  int signal_id;
+  /* Satellites listed within this GSV message. */
+  size_t num_entries;
+  SatelliteInView satellite[GSV_MAX_SATELLITES];
+  ReceiveTime received;
+} GsvData;
+
+enum class FixType
+{
+  Invalid, NoFix, Fix2D, Fix3D
+};
+
+typedef RmcSource GsaSource;
+
+typedef struct
+{
+  GsaSource source;
+  /* Automatic (A) or manual (M) selection of 2D/3D mode. */
+  bool is_automatic;
+  FixType fix_type;
+  /* Dilution of precision: position, horizontal, vertical. */
+  float pdop;
+  float hdop;
+  float vdop;
+  /* GNSS system id (NMEA 4.10 and later), -1 if not present. */
+  int system_id;
+  /* Satellites used in the fix, indexed by Constellation. Bit
+   * n - 1 is set if satellite number n, see toSatelliteNumber(),
+   * is used, hence isActive() and numActive() are cheap bit
+   * operations.
+   */
+  uint64_t active[NUM_CONSTELLATIONS];
+  ReceiveTime received;
+} GsaData;
+
+/* Parts of a NMEA message which are delivered ahead of its
+ * checksum when early dispatch is enabled.
+ */
+enum class Provisional
+{
+  Time, Position
+};
+
+/* Outcome of the checksum verification of a NMEA message
+ * whose contents have already been delivered provisionally.
+ */
+enum class Verdict
+{
+  Confirmed, Retracted
+};
+
+/* Caches the number of days since 1970-01-01 for the last
+ * converted date, since the date only changes once a day.
+ */
+typedef struct
+{
+  Date date;
+  int32_t epoch_day;
+} EpochDayCache;
+
 /**************************************************************************************
  * CONST
  **************************************************************************************/
 
+int32_t const INVALID_COORDINATE_E7 = INT32_MIN;
+int32_t const INVALID_EPOCH_DAY     = -1;
 Time    const INVALID_TIME = {-1, -1, -1, -1};
 Date    const INVALID_DATE = {-1, -1, -1};
-RmcData const INVALID_RMC  = {RmcSource::Unknown, INVALID_TIME, false, NAN, NAN, NAN, NAN, NAN, INVALID_DATE};
-GgaData const INVALID_GGA  = {GgaSource::Unknown, INVALID_TIME, NAN, NAN, FixQuality::Invalid, -1, NAN, NAN, NAN, -1, {0}};
+ReceiveTime const INVALID_RECEIVE_TIME = {0, 0};
+RmcData const INVALID_RMC  = {RmcSource::Unknown, INVALID_TIME, false, NAN, NAN, INVALID_COORDINATE_E7, INVALID_COORDINATE_E7, NAN, NAN, NAN, INVALID_DATE, INVALID_RECEIVE_TIME};
+GgaData const INVALID_GGA  = {GgaSource::Unknown, INVALID_TIME, NAN, NAN, INVALID_COORDINATE_E7, INVALID_COORDINATE_E7, FixQuality::Invalid, -1, NAN, NAN, NAN, -1, {0}, INVALID_RECEIVE_TIME};
+SatelliteInView const INVALID_SATELLITE_IN_VIEW = {-1, -1, -1, -1};
+GsvData const INVALID_GSV  = {GsvSource::Unknown, -1, -1, -1, -1, 0, {INVALID_SATELLITE_IN_VIEW, INVALID_SATELLITE_IN_VIEW, INVALID_SATELLITE_IN_VIEW, INVALID_SATELLITE_IN_VIEW}, INVALID_RECEIVE_TIME};
+GsaData const INVALID_GSA  = {GsaSource::Unknown, false, FixType::Invalid, NAN, NAN, NAN, -1, {0}, INVALID_RECEIVE_TIME};
+EpochDayCache const INVALID_EPOCH_DAY_CACHE = {INVALID_DATE, INVALID_EPOCH_DAY};
 
 /**************************************************************************************
  * FUNCTION DECLARATION
  **************************************************************************************/
 
-bool   isValid         (Date const & date);
-bool   isValid         (Time const & time);
-bool   isValid         (Date const & date, Time const & time);
-time_t toPosixTimestamp(Date const & date, Time const & time);
+bool    isValid         (Date const & date);
+bool    isValid         (Time const & time);
+bool    isValid         (Date const & date, Time const & time);
+int32_t toEpochDay      (Date const & date);
+time_t  toPosixTimestamp(Date const & date, Time const & time);
+time_t  toPosixTimestamp(Date const & date, Time const & time, EpochDayCache & cache);
+
+/* Maps the talker of a GSV/GSA message onto its constellation,
+ * returns false for GNSS and Unknown.
+ */
+bool    toConstellation (RmcSource const source, Constellation & constellation);
+
+/* Number 1 - 64 of the satellite with the NMEA satellite id 'id'
+ * within its constellation: GPS 1 - 32 (SBAS 33 - 64), GLONASS
+ * 65 - 96, QZSS 193 - 202, Galileo 301 - 336 and BeiDou 401 - 463
+ * as well as the numbering of NMEA 4.11 with ids 1 - 64 for all
+ * constellations. Returns 0 for all other ids.
+ */
+int     toSatelliteNumber(int const id);
+
+/* True if the satellite with the NMEA satellite id 'id' of
+ * 'constellation' is used in the fix.
+ */
+bool    isActive (GsaData const & gsa, Constellation const constellation, int const id);
+/* Number of satellites used in the fix. */
+size_t  numActive(GsaData const & gsa, Constellation const constellation);
+size_t  numActive(GsaData const & gsa);
 
 /**************************************************************************************
  * NAMESPACE
@@ -11,14 +11,8 @@
 
 #include "checksum.h"
 
-#include <stdint.h>
-#include <stdlib.h>
 #include <string.h>
 
-#undef max
-#undef min
-#include <algorithm>
-
 /**************************************************************************************
  * NAMESPACE
  **************************************************************************************/
@@ -30,11 +24,28 @@ namespace util
 {
 
 /**************************************************************************************
- * INTERNAL FUNCTION DECLARATION
+ * CONSTANTS
  **************************************************************************************/
 
-uint8_t calcChecksum   (char const * const nmea_str);
-uint8_t extractChecksum(char const * const nmea_str);
+/* Lookup table for converting the hexadecimal digits
+ * '0' to '9', 'A' to 'F' and 'a' to 'f' into their
+ * numeric value. The table is indexed by (c - '0').
+ */
+static uint8_t const HEX_DIGIT_TABLE['f' - '0' + 1] =
+{
+  /* '0' - '9' */  0,  1,  2,  3,  4,  5,  6,  7,  8,  9,
+  /* ':' - '@' */ INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT,
+                  INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT,
+  /* 'A' - 'F' */ 10, 11, 12, 13, 14, 15,
+  /* 'G' - '`' */ INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT,
+                  INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT,
+                  INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT,
+                  INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT,
+                  INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT,
+                  INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT, INVALID_HEX_DIGIT,
+                  INVALID_HEX_DIGIT, INVALID_HEX_DIGIT,
+  /* 'a' - 'f' */ 10, 11, 12, 13, 14, 15,
+};
 
 /**************************************************************************************
  * FUNCTION DEFINITION
@@ -42,53 +53,52 @@ uint8_t extractChecksum(char const * const nmea_str);
 
 /* This function expects a zero-terminated string containing a full NMEA
  * message starting with '$' and ending after the trailing \r\n, e.g.
- * "$GPRMC,......*CA\r\n\0".
+ * "$GPRMC,......*CA\r\n\0". It keeps no state between invocations and
+ * can therefore be called concurrently from multiple threads.
  */
 bool isChecksumOk(char const * const nmea_str)
 {
-  return (calcChecksum(nmea_str) == extractChecksum(nmea_str));
+  /* Find the start of the NMEA message. */
+  char const * const start = strchr(nmea_str, '$');
+  if (!start)
+    return false;
+
+  /* Find the start of the checksum. */
+  char const * const start_checksum = strchr(start, '*');
+  if (!start_checksum)
+    return false;
+
+  /* Convert both hexadecimal digits following the '*'.
+   * In case the string is terminated right after the '*'
+   * the conversion of the first digit already fails.
+   */
+  uint8_t const hi = hexDigitToNibble(start_checksum[1]);
+  if (hi == INVALID_HEX_DIGIT)
+    return false;
+  uint8_t const lo = hexDigitToNibble(start_checksum[2]);
+  if (lo == INVALID_HEX_DIGIT)
+    return false;
+
+  uint8_t const checksum_received = (hi << 4) | lo;
+  uint8_t const checksum_calculated = updateChecksum(0, start + 1, start_checksum - (start + 1));
+
+  return (checksum_calculated == checksum_received);
 }
 
-/**************************************************************************************
- * INTERNAL FUNCTION DEFINITION
- **************************************************************************************/
-
-uint8_t calcChecksum(char const * const nmea_str)
+uint8_t updateChecksum(uint8_t checksum, char const * buf, size_t const len)
 {
-  uint8_t checksum = 0;
-
-  std::for_each(nmea_str,
-                nmea_str + strlen(nmea_str),
-                [&checksum](char const c)
-                {
-                  static bool use_char_for_checksum = false;
-
-                  if (c == '$') {
-                    use_char_for_checksum = true;
-                    return;
-                  }
-
-                  if (c == '*') {
-                    use_char_for_checksum = false;
-                    return;
-                  }
-
-                  if (use_char_for_checksum)
-                    checksum ^= static_cast<uint8_t>(c);
-                });
+  for (size_t i = 0; i < len; i++)
+    checksum ^= static_cast<uint8_t>(buf[i]);
 
   return checksum;
 }
 
-uint8_t extractChecksum(char const * const nmea_str)
+uint8_t hexDigitToNibble(char const c)
 {
-  char checksum_str[3] = {0};
-  /* Find the start of the checksum message */
-  char const * start_checksum = strchr(nmea_str, '*');
-  /* Extract checksum. */
-  strncpy(checksum_str, start_checksum + 1, 2);
-  /* Convert to integer. */
-  return strtol(checksum_str, nullptr, 16);
+  if (c < '0' || c > 'f')
+    return INVALID_HEX_DIGIT;
+
+  return HEX_DIGIT_TABLE[c - '0'];
 }
 
 /**************************************************************************************
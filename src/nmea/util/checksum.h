@@ -8,6 +8,13 @@
 #ifndef ARDUINO_NMEA_UTIL_CHECKSUM_H_
 #define ARDUINO_NMEA_UTIL_CHECKSUM_H_
 
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
 /**************************************************************************************
  * NAMESPACE
  **************************************************************************************/
@@ -18,11 +25,19 @@ namespace nmea
 namespace util
 {
 
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+static uint8_t constexpr INVALID_HEX_DIGIT = 0xFF;
+
 /**************************************************************************************
  * FUNCTION DECLARATION
  **************************************************************************************/
 
-bool isChecksumOk(char const * const nmea_str);
+bool    isChecksumOk    (char const * const nmea_str);
+uint8_t updateChecksum  (uint8_t checksum, char const * buf, size_t const len);
+uint8_t hexDigitToNibble(char const c);
 
 /**************************************************************************************
  * NAMESPACE
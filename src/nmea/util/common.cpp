@@ -11,12 +11,11 @@
 
 #include "common.h"
 
-#include <string.h>
-#include <stdlib.h>
+#undef max
+#undef min
+#include <algorithm>
 
-#ifdef ARDUINO_ARCH_ESP32
-#  include <stdlib_noniso.h>
-#endif
+#include "numeric.h"
 
 /**************************************************************************************
  * NAMESPACE
@@ -32,41 +31,95 @@ namespace util
  * FUNCTION DEFINITION
  **************************************************************************************/
 
-void parseTime(char const * token, Time & time_utc)
+void parseTime(char const * token, size_t const token_len, Time & time_utc)
 {
-  char const hour_str       [] = {token[0], token[1], '\0'};
-  char const minute_str     [] = {token[2], token[3], '\0'};
-  char const second_str     [] = {token[4], token[5], '\0'};
-  char const microsecond_str[] = {token[7], token[8], token[9],'\0'};
-
-  time_utc.hour        = atoi(hour_str);
-  time_utc.minute      = atoi(minute_str);
-  time_utc.second      = atoi(second_str);
-  time_utc.microsecond = atoi(microsecond_str);
+  /* hhmmss[.sss] */
+  if (token_len < 6) {
+    time_utc = INVALID_TIME;
+    return;
+  }
+
+  time_utc.hour        = parseInt(token + 0, 2);
+  time_utc.minute      = parseInt(token + 2, 2);
+  time_utc.second      = parseInt(token + 4, 2);
+  time_utc.microsecond = (token_len > 7) ? parseInt(token + 7, std::min(token_len - 7, static_cast<size_t>(3))) : 0;
 }
 
-float parseLatitude(char const * token)
+/* The degrees are added to the minutes in double precision
+ * in order to retain the resolution of the minutes.
+ */
+static float parseCoordinate(char const * token, size_t const token_len, size_t const deg_digits)
 {
-  char const deg_str[] = {token[0], token[1], '\0'};
-  char min_str[10] = {0};
-  strncpy(min_str, token + 2, sizeof(min_str));
+  if (token_len < deg_digits)
+    return parseInt(token, token_len);
+
+  float coordinate  = parseInt(token, deg_digits);
+        coordinate += toDouble(parseDecimal(token + deg_digits, token_len - deg_digits)) / 60.0f;
 
-  float latitude  = atoi(deg_str);
-        latitude += atof(min_str) / 60.0f;
+  return coordinate;
+}
+
+float parseLatitude(char const * token, size_t const token_len)
+{
+  /* ddmm.mmmm */
+  return parseCoordinate(token, token_len, 2);
+}
 
-  return latitude;
+float parseLongitude(char const * token, size_t const token_len)
+{
+  /* dddmm.mmmm */
+  return parseCoordinate(token, token_len, 3);
 }
 
-float parseLongitude(char const * token)
+/* Computes degrees * 10^7 + minutes * 10^7 / 60 with the
+ * minutes given as mantissa * 10^exponent, i.e. the result is
+ * mantissa * 10^7 / (60 * 10^-exponent) rounded to nearest.
+ */
+static int32_t parseCoordinateE7(char const * token, size_t const token_len, size_t const deg_digits)
 {
-  char const deg_str[] = {token[0], token[1], token[2], '\0'};
-  char min_str[10] = {0};
-  strncpy(min_str, token + 3, sizeof(min_str));
+  static uint64_t const POW10[] =
+  {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL
+  };
+  static int constexpr MAX_FRAC_DIGITS = sizeof(POW10) / sizeof(POW10[0]) - 1;
+
+  if (token_len < deg_digits)
+    return INVALID_COORDINATE_E7;
+
+  int const deg = parseInt(token, deg_digits);
+  Decimal minutes = parseDecimal(token + deg_digits, token_len - deg_digits);
 
-  float longitude  = atoi(deg_str);
-        longitude += atof(min_str) / 60.0f;
+  /* Fractional digits beyond 1e-10 minutes are far below the
+   * resolution of the result and therefore dropped.
+   */
+  while (minutes.exponent < -MAX_FRAC_DIGITS) {
+    minutes.mantissa /= 10;
+    minutes.exponent++;
+  }
 
-  return longitude;
+  /* Minutes must be below 60, this also prevents an overflow. */
+  if (minutes.exponent > 0 || minutes.is_negative || minutes.mantissa >= 60 * POW10[-minutes.exponent])
+    return INVALID_COORDINATE_E7;
+
+  uint64_t const num = minutes.mantissa * POW10[7];
+  uint64_t const den = 60 * POW10[-minutes.exponent];
+
+  int64_t const coordinate_e7 = static_cast<int64_t>(deg) * static_cast<int64_t>(POW10[7]) + static_cast<int64_t>((num + den / 2) / den);
+
+  if (coordinate_e7 < 0 || coordinate_e7 > INT32_MAX)
+    return INVALID_COORDINATE_E7;
+
+  return static_cast<int32_t>(coordinate_e7);
+}
+
+int32_t parseLatitudeE7(char const * token, size_t const token_len)
+{
+  return parseCoordinateE7(token, token_len, 2);
+}
+
+int32_t parseLongitudeE7(char const * token, size_t const token_len)
+{
+  return parseCoordinateE7(token, token_len, 3);
 }
 
 /**************************************************************************************
@@ -12,6 +12,9 @@
  * INCLUDES
  **************************************************************************************/
 
+#include <stdint.h>
+#include <stdlib.h>
+
 #include "../Types.h"
 
 /**************************************************************************************
@@ -28,9 +31,15 @@ namespace util
  * FUNCTION DECLARATION
  **************************************************************************************/
 
-void  parseTime     (char const * token, Time & time_utc);
-float parseLatitude (char const * token);
-float parseLongitude(char const * token);
+void  parseTime     (char const * token, size_t const token_len, Time & time_utc);
+float parseLatitude (char const * token, size_t const token_len);
+float parseLongitude(char const * token, size_t const token_len);
+
+/* Integer only variants yielding 1e-7 degrees, the result
+ * is rounded to the nearest representable value.
+ */
+int32_t parseLatitudeE7 (char const * token, size_t const token_len);
+int32_t parseLongitudeE7(char const * token, size_t const token_len);
 
 /**************************************************************************************
  * NAMESPACE
@@ -0,0 +1,65 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "dispatch.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+namespace util
+{
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+Formatter parseFormatter(char const * token, size_t const token_len)
+{
+  /* "$GPRMC": '$', two characters talker id, three characters formatter. */
+  if (token_len != 6)
+    return INVALID_FORMATTER;
+
+  for (size_t i = 3; i < 6; i++)
+    if (token[i] < 'A' || token[i] > 'Z')
+      return INVALID_FORMATTER;
+
+  return toFormatter(token[3], token[4], token[5]);
+}
+
+RmcSource parseTalker(char const * token, size_t const token_len)
+{
+  if (token_len != 6)
+    return RmcSource::Unknown;
+
+  switch ((token[1] << 8) | token[2])
+  {
+  case ('G' << 8) | 'P': return RmcSource::GPS;
+  case ('G' << 8) | 'L': return RmcSource::GLONASS;
+  case ('G' << 8) | 'A': return RmcSource::Galileo;
+  case ('G' << 8) | 'N': return RmcSource::GNSS;
+  case ('B' << 8) | 'D': /* BeiDou talker id prior to NMEA 4.11 */
+  case ('G' << 8) | 'B': return RmcSource::BDS;
+  case ('G' << 8) | 'Q': return RmcSource::QZSS;
+  default:               return RmcSource::Unknown;
+  }
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* util */
+
+} /* nmea */
@@ -0,0 +1,138 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_UTIL_DISPATCH_H_
+#define ARDUINO_NMEA_UTIL_DISPATCH_H_
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../Types.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+namespace util
+{
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* The three character formatter of a NMEA message id, i.e.
+ * "RMC" in "$GPRMC", packed into 5 bits per character.
+ */
+typedef uint16_t Formatter;
+
+static Formatter constexpr INVALID_FORMATTER = 0xFFFF;
+
+static size_t  constexpr DISPATCH_TABLE_SIZE = 32;
+static uint8_t constexpr DISPATCH_SLOT_EMPTY = 0xFF;
+
+/* Maps each slot of the dispatch table to the index of the
+ * registered formatter occupying this slot.
+ */
+typedef struct
+{
+  uint8_t entry[DISPATCH_TABLE_SIZE];
+} DispatchTable;
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+constexpr Formatter toFormatter(char const f0, char const f1, char const f2)
+{
+  return static_cast<Formatter>(((f0 - 'A') << 10) | ((f1 - 'A') << 5) | (f2 - 'A'));
+}
+
+/* Hash function for mapping a formatter onto a slot of the dispatch
+ * table. It is collision free for RMC, GGA, GSA, GSV, VTG, GLL, ZDA,
+ * GST, GNS, TXT, HDT, GBS, DTM and GRS. makeDispatchTable() verifies
+ * that no collisions occur for the formatters actually registered.
+ */
+constexpr uint8_t toDispatchSlot(Formatter const formatter)
+{
+  return static_cast<uint8_t>((((formatter >> 5) & 0x1F) + 2 * (formatter & 0x1F)) & (DISPATCH_TABLE_SIZE - 1));
+}
+
+/* Extracts the formatter from the message id field, e.g. "$GPRMC". */
+Formatter parseFormatter(char const * token, size_t const token_len);
+
+/* Decodes the talker id of the message id field, e.g. "$GPRMC",
+ * into the satellite system the NMEA message originates from.
+ */
+RmcSource parseTalker(char const * token, size_t const token_len);
+
+/**************************************************************************************
+ * COMPILE TIME DISPATCH TABLE CONSTRUCTION
+ **************************************************************************************/
+
+namespace detail
+{
+
+template <size_t... I> struct IndexSequence { };
+template <size_t N, size_t... I> struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, I...> { };
+template <size_t... I> struct MakeIndexSequence<0, I...> { typedef IndexSequence<I...> type; };
+
+constexpr uint8_t findEntry(size_t const slot, Formatter const * formatters, size_t const num_formatters, size_t const idx)
+{
+  return (idx == num_formatters) ? DISPATCH_SLOT_EMPTY :
+         (toDispatchSlot(formatters[idx]) == slot) ? static_cast<uint8_t>(idx) :
+         findEntry(slot, formatters, num_formatters, idx + 1);
+}
+
+constexpr size_t countEntries(size_t const slot, Formatter const * formatters, size_t const num_formatters, size_t const idx)
+{
+  return (idx == num_formatters) ? 0 : (((toDispatchSlot(formatters[idx]) == slot) ? 1 : 0) + countEntries(slot, formatters, num_formatters, idx + 1));
+}
+
+constexpr bool isCollisionFree(Formatter const * formatters, size_t const num_formatters, size_t const slot)
+{
+  return (slot == DISPATCH_TABLE_SIZE) ? true :
+         (countEntries(slot, formatters, num_formatters, 0) <= 1) && isCollisionFree(formatters, num_formatters, slot + 1);
+}
+
+template <size_t... SLOT>
+constexpr DispatchTable makeDispatchTable(Formatter const * formatters, size_t const num_formatters, IndexSequence<SLOT...>)
+{
+  return DispatchTable{{findEntry(SLOT, formatters, num_formatters, 0)...}};
+}
+
+} /* detail */
+
+/* Returns true if every registered formatter occupies its own slot. */
+template <size_t N>
+constexpr bool isCollisionFree(Formatter const (&formatters)[N])
+{
+  return detail::isCollisionFree(formatters, N, 0);
+}
+
+/* Builds the dispatch table for a list of formatters at compile time. */
+template <size_t N>
+constexpr DispatchTable makeDispatchTable(Formatter const (&formatters)[N])
+{
+  return detail::makeDispatchTable(formatters, N, typename detail::MakeIndexSequence<DISPATCH_TABLE_SIZE>::type());
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* util */
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_UTIL_DISPATCH_H_ */
@@ -0,0 +1,64 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "field.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+namespace util
+{
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+void buildFieldIndex(char const * nmea, FieldIndex & index)
+{
+  size_t field_start = 0;
+  size_t pos = 0;
+
+  index.num_fields = 0;
+
+  for (;; pos++)
+  {
+    char const c = nmea[pos];
+    bool const is_end_of_field = (c == ',');
+    bool const is_end_of_data  = (c == '*') || (c == '\r') || (c == '\n') || (c == '\0');
+
+    if (!is_end_of_field && !is_end_of_data)
+      continue;
+
+    if (index.num_fields < MAX_FIELDS)
+    {
+      index.field[index.num_fields].offset = static_cast<uint8_t>(field_start);
+      index.field[index.num_fields].length = static_cast<uint8_t>(pos - field_start);
+      index.num_fields++;
+    }
+
+    if (is_end_of_data)
+      return;
+
+    field_start = pos + 1;
+  }
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* util */
+
+} /* nmea */
@@ -0,0 +1,72 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_UTIL_FIELD_H_
+#define ARDUINO_NMEA_UTIL_FIELD_H_
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+namespace util
+{
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+/* Maximum number of comma separated fields of a NMEA message
+ * which are indexed, any further fields are ignored.
+ */
+static size_t constexpr MAX_FIELDS = 24;
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+typedef struct
+{
+  uint8_t offset;
+  uint8_t length;
+} Field;
+
+typedef struct
+{
+  Field field[MAX_FIELDS];
+  size_t num_fields;
+} FieldIndex;
+
+/**************************************************************************************
+ * FUNCTION DECLARATION
+ **************************************************************************************/
+
+/* Determines offset and length of all comma separated fields of
+ * the NMEA message 'nmea', e.g. "$GPRMC,......*CA\r\n", without
+ * modifying it. The first field contains the leading '$' and the
+ * last field ends before the '*' marking the start of the checksum.
+ */
+void buildFieldIndex(char const * nmea, FieldIndex & index);
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* util */
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_UTIL_FIELD_H_ */
@@ -0,0 +1,190 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "numeric.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+namespace util
+{
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+/* Limit the number of significant digits so that the mantissa
+ * can not overflow, further digits are dropped.
+ */
+static size_t   constexpr MAX_SIGNIFICANT_DIGITS = 19;
+
+/* Integers up to 2^24 (float) respectively 2^53 (double) and
+ * powers of ten up to 10^10 (float) respectively 10^22 (double)
+ * are exactly representable. A single division of two exact
+ * operands is correctly rounded, therefore its result equals
+ * the correctly rounded result of strtod. For float it has been
+ * exhaustively verified that dividing in single precision yields
+ * the same result as dividing in double precision and rounding
+ * to float afterwards, as done by assigning atof to a float.
+ */
+static uint64_t constexpr MAX_EXACT_FLOAT_MANTISSA  = 1ULL << 24;
+static uint64_t constexpr MAX_EXACT_DOUBLE_MANTISSA = 1ULL << 53;
+
+static float const POW10_FLOAT[] =
+{
+  1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+static double const POW10_DOUBLE[] =
+{
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static int constexpr MAX_EXACT_FLOAT_POW10  = sizeof(POW10_FLOAT)  / sizeof(POW10_FLOAT[0])  - 1;
+static int constexpr MAX_EXACT_DOUBLE_POW10 = sizeof(POW10_DOUBLE) / sizeof(POW10_DOUBLE[0]) - 1;
+
+/**************************************************************************************
+ * INTERNAL FUNCTION DEFINITION
+ **************************************************************************************/
+
+static inline bool isDigit(char const c)
+{
+  return (c >= '0') && (c <= '9');
+}
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+Decimal parseDecimal(char const * token, size_t const token_len)
+{
+  Decimal decimal = {0, 0, false};
+  size_t num_significant_digits = 0;
+  size_t num_digits = 0;
+  size_t i = 0;
+
+  if (i < token_len && (token[i] == '+' || token[i] == '-'))
+  {
+    decimal.is_negative = (token[i] == '-');
+    i++;
+  }
+
+  for (; i < token_len && isDigit(token[i]); i++, num_digits++)
+  {
+    if (num_significant_digits < MAX_SIGNIFICANT_DIGITS) {
+      decimal.mantissa = decimal.mantissa * 10 + (token[i] - '0');
+      if (decimal.mantissa > 0) num_significant_digits++;
+    }
+    else
+      decimal.exponent++;
+  }
+
+  if (i < token_len && token[i] == '.')
+  {
+    for (i++; i < token_len && isDigit(token[i]); i++, num_digits++)
+    {
+      if (num_significant_digits < MAX_SIGNIFICANT_DIGITS) {
+        decimal.mantissa = decimal.mantissa * 10 + (token[i] - '0');
+        decimal.exponent--;
+        if (decimal.mantissa > 0) num_significant_digits++;
+      }
+    }
+  }
+
+  /* Without any digits no conversion takes place at all. */
+  if (num_digits == 0)
+    decimal.is_negative = false;
+
+  return decimal;
+}
+
+int parseInt(char const * token, size_t const token_len)
+{
+  bool is_negative = false;
+  int value = 0;
+  size_t i = 0;
+
+  if (i < token_len && (token[i] == '+' || token[i] == '-'))
+  {
+    is_negative = (token[i] == '-');
+    i++;
+  }
+
+  for (; i < token_len && isDigit(token[i]); i++)
+    value = value * 10 + (token[i] - '0');
+
+  return is_negative ? -value : value;
+}
+
+float parseFloat(char const * token, size_t const token_len)
+{
+  return toFloat(parseDecimal(token, token_len));
+}
+
+float toFloat(Decimal const & decimal)
+{
+  /* Fast path entirely in single precision which covers
+   * all values typically found within NMEA messages.
+   */
+  if (decimal.mantissa <= MAX_EXACT_FLOAT_MANTISSA && decimal.exponent <= 0 && -decimal.exponent <= MAX_EXACT_FLOAT_POW10)
+  {
+    float const value = static_cast<float>(decimal.mantissa) / POW10_FLOAT[-decimal.exponent];
+    return decimal.is_negative ? -value : value;
+  }
+
+  return static_cast<float>(toDouble(decimal));
+}
+
+double toDouble(Decimal const & decimal)
+{
+  double value = static_cast<double>(decimal.mantissa);
+
+  if (decimal.mantissa <= MAX_EXACT_DOUBLE_MANTISSA && decimal.exponent <= 0 && -decimal.exponent <= MAX_EXACT_DOUBLE_POW10)
+    value /= POW10_DOUBLE[-decimal.exponent];
+  else if (decimal.mantissa <= MAX_EXACT_DOUBLE_MANTISSA && decimal.exponent > 0 && decimal.exponent <= MAX_EXACT_DOUBLE_POW10)
+    value *= POW10_DOUBLE[decimal.exponent];
+  else
+  {
+    /* Numbers with more than 15 significant digits do not occur
+     * within NMEA messages, they are approximated without the
+     * guarantee of correct rounding.
+     */
+    for (int e = decimal.exponent; e < 0; e++) value /= 10.0;
+    for (int e = decimal.exponent; e > 0; e--) value *= 10.0;
+  }
+
+  return decimal.is_negative ? -value : value;
+}
+
+size_t popcount(uint64_t const bits)
+{
+#if defined(__GNUC__)
+  return static_cast<size_t>(__builtin_popcountll(bits));
+#else
+  size_t count = 0;
+  for (uint64_t b = bits; b != 0; b &= (b - 1))
+    count++;
+  return count;
+#endif
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* util */
+
+} /* nmea */
@@ -0,0 +1,73 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-NMEA-Parser/graphs/contributors.
+ */
+
+#ifndef ARDUINO_NMEA_UTIL_NUMERIC_H_
+#define ARDUINO_NMEA_UTIL_NUMERIC_H_
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace nmea
+{
+
+namespace util
+{
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* A decimal number of the form [+-]ddd[.ddd] as found within
+ * NMEA fields, its value is mantissa * 10^exponent.
+ */
+typedef struct
+{
+  uint64_t mantissa;
+  int      exponent;
+  bool     is_negative;
+} Decimal;
+
+/**************************************************************************************
+ * FUNCTION DECLARATION
+ **************************************************************************************/
+
+/* The following functions replace atof/atoi for decoding NMEA
+ * fields. They only accept the NMEA number grammar, do not depend
+ * on the current locale and never read beyond 'token_len' characters.
+ * Just like atof/atoi parsing stops at the first character not
+ * matching the grammar and the number parsed so far is returned.
+ */
+Decimal parseDecimal(char const * token, size_t const token_len);
+int     parseInt    (char const * token, size_t const token_len);
+float   parseFloat  (char const * token, size_t const token_len);
+
+/* Both conversions yield the same result as converting
+ * the output of atof to the respective type.
+ */
+float   toFloat     (Decimal const & decimal);
+double  toDouble    (Decimal const & decimal);
+
+/* Number of bits set within 'bits'. */
+size_t  popcount    (uint64_t const bits);
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* util */
+
+} /* nmea */
+
+#endif /* ARDUINO_NMEA_UTIL_NUMERIC_H_ */
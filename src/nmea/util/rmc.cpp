@@ -11,9 +11,10 @@
 
 #include "rmc.h"
 
-#include <string.h>
 #include <stdlib.h>
 
+#include "numeric.h"
+
 /**************************************************************************************
  * NAMESPACE
  **************************************************************************************/
@@ -28,45 +29,17 @@ namespace util
  * FUNCTION DEFINITION
  **************************************************************************************/
 
-bool rmc_isGPRMC(char const * nmea)
-{
-  return (strncmp(nmea, "$GPRMC", 6) == 0);
-}
-
-bool rmc_isGLRMC(char const * nmea)
-{
-  return (strncmp(nmea, "$GLRMC", 6) == 0);
-}
-
-bool rmc_isGARMC(char const * nmea)
-{
-  return (strncmp(nmea, "$GARMC", 6) == 0);
-}
-
-bool rmc_isGNRMC(char const * nmea)
-{
-  return (strncmp(nmea, "$GNRMC", 6) == 0);
-}
-
-bool rmc_isBDRMC(char const * nmea)
-{
-  return (strncmp(nmea, "$BDRMC", 6) == 0);
-}
-
-bool rmc_isGxRMC(char const * nmea)
-{
-  return (rmc_isGPRMC(nmea) || rmc_isGLRMC(nmea) || rmc_isGARMC(nmea) || rmc_isGNRMC(nmea) || rmc_isBDRMC(nmea));
-}
-
-void rmc_parseDate(char const * token, Date & date)
+void rmc_parseDate(char const * token, size_t const token_len, Date & date)
 {
-  char const day_str  [] = {token[0], token[1], '\0'};
-  char const month_str[] = {token[2], token[3], '\0'};
-  char const year_str [] = {token[4], token[5], '\0'};
+  /* ddmmyy */
+  if (token_len < 6) {
+    date = INVALID_DATE;
+    return;
+  }
 
-  date.day   = atoi(day_str);
-  date.month = atoi(month_str);
-  date.year  = 2000 + atoi(year_str);
+  date.day   = parseInt(token + 0, 2);
+  date.month = parseInt(token + 2, 2);
+  date.year  = 2000 + parseInt(token + 4, 2);
 }
 
 /**************************************************************************************
@@ -12,6 +12,8 @@
  * INCLUDES
  **************************************************************************************/
 
+#include <stdlib.h>
+
 #include "../Types.h"
 
 /**************************************************************************************
@@ -28,13 +30,7 @@ namespace util
  * FUNCTION DECLARATION
  **************************************************************************************/
 
-bool  rmc_isGPRMC       (char const * nmea);
-bool  rmc_isGLRMC       (char const * nmea);
-bool  rmc_isGARMC       (char const * nmea);
-bool  rmc_isGNRMC       (char const * nmea);
-bool  rmc_isBDRMC       (char const * nmea);
-bool  rmc_isGxRMC       (char const * nmea);
-void  rmc_parseDate     (char const * token, Date & date);
+void rmc_parseDate(char const * token, size_t const token_len, Date & date);
 
 /**************************************************************************************
  * NAMESPACE